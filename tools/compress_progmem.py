@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+
+"""
+Compresses a binary file into a C++ header for use with progmem::CompressedStream.
+
+The compressed format is a simple LZSS:
+
+* A 2-byte little-endian header containing the decompressed size.
+* A sequence of groups, each starting with a flag byte that describes
+  the next 8 items, least significant bit first.
+  * A set flag bit means the item is a single literal byte.
+  * A clear flag bit means the item is a 2-byte back-reference:
+    * byte 0: the low 8 bits of (distance - 1)
+    * byte 1: the high 4 bits of (distance - 1) in the upper nibble,
+      and (length - 3) in the lower nibble.
+
+Back-references may reach at most 'window size' bytes into the past,
+and the decoder must be given a window at least that large.
+
+Usage:
+	compress_progmem.py input.bin name [--window-bits 8] [--output name.h]
+"""
+
+import argparse
+import os
+import sys
+
+minimum_match = 3
+maximum_match = minimum_match + 15
+maximum_window_bits = 12
+
+
+def find_match(data, position, window_size):
+	best_length = 0
+	best_distance = 0
+
+	limit = min(maximum_match, len(data) - position)
+
+	if limit < minimum_match:
+		return (0, 0)
+
+	start = max(0, position - window_size)
+
+	for candidate in range(position - 1, start - 1, -1):
+		length = 0
+
+		# Matches may overlap the current position
+		while (length < limit) and (data[candidate + length] == data[position + length]):
+			length += 1
+
+		if length > best_length:
+			best_length = length
+			best_distance = position - candidate
+
+			if length == limit:
+				break
+
+	if best_length < minimum_match:
+		return (0, 0)
+
+	return (best_length, best_distance)
+
+
+def compress(data, window_bits):
+	window_size = 1 << window_bits
+
+	output = bytearray()
+	output += len(data).to_bytes(2, 'little')
+
+	position = 0
+	flag_index = 0
+	flag_count = 0
+
+	while position < len(data):
+		if flag_count == 0:
+			flag_index = len(output)
+			output.append(0)
+
+		(length, distance) = find_match(data, position, window_size)
+
+		if length == 0:
+			output[flag_index] |= (1 << flag_count)
+			output.append(data[position])
+			position += 1
+		else:
+			encoded_distance = distance - 1
+			output.append(encoded_distance & 0xFF)
+			output.append(((encoded_distance >> 8) << 4) | (length - minimum_match))
+			position += length
+
+		flag_count = (flag_count + 1) % 8
+
+	return output
+
+
+def decompress(data):
+	size = int.from_bytes(data[0:2], 'little')
+	output = bytearray()
+	position = 2
+	flags = 0
+	flag_count = 0
+
+	while len(output) < size:
+		if flag_count == 0:
+			flags = data[position]
+			position += 1
+			flag_count = 8
+
+		literal = (flags & 1) != 0
+		flags >>= 1
+		flag_count -= 1
+
+		if literal:
+			output.append(data[position])
+			position += 1
+		else:
+			distance = (data[position] | ((data[position + 1] >> 4) << 8)) + 1
+			length = (data[position + 1] & 0x0F) + minimum_match
+			position += 2
+
+			for _ in range(length):
+				output.append(output[-distance])
+
+	return bytes(output[:size])
+
+
+def make_header(name, source_name, data, compressed, window_bits):
+	lines = []
+	lines.append('#pragma once')
+	lines.append('')
+	lines.append('// Generated by compress_progmem.py from \'{}\'. Do not edit.'.format(source_name))
+	lines.append('// {} bytes compressed to {} bytes.'.format(len(data), len(compressed)))
+	lines.append('')
+	lines.append('// For size_t')
+	lines.append('#include <stddef.h>')
+	lines.append('')
+	lines.append('// For uint8_t')
+	lines.append('#include <stdint.h>')
+	lines.append('')
+	lines.append('// For PROGMEM')
+	lines.append('#include <avr/pgmspace.h>')
+	lines.append('')
+	lines.append('constexpr size_t {}_window_size = {};'.format(name, 1 << window_bits))
+	lines.append('constexpr size_t {}_size = {};'.format(name, len(data)))
+	lines.append('')
+	lines.append('constexpr uint8_t {}[] PROGMEM ='.format(name))
+	lines.append('{')
+
+	for start in range(0, len(compressed), 16):
+		row = compressed[start:start + 16]
+		lines.append('\t' + ' '.join('0x{:02X},'.format(value) for value in row))
+
+	lines.append('};')
+
+	return '\r\n'.join(lines)
+
+
+def main():
+	parser = argparse.ArgumentParser(description = 'Compress a file for progmem::CompressedStream.')
+	parser.add_argument('input', help = 'the file to compress')
+	parser.add_argument('name', help = 'the name of the generated array')
+	parser.add_argument('--window-bits', type = int, default = 8, help = 'log2 of the window size, from 1 to {} (default 8)'.format(maximum_window_bits))
+	parser.add_argument('--output', help = 'the header to write (default: standard output)')
+	arguments = parser.parse_args()
+
+	if not (1 <= arguments.window_bits <= maximum_window_bits):
+		parser.error('--window-bits must be between 1 and {}'.format(maximum_window_bits))
+
+	with open(arguments.input, 'rb') as file:
+		data = file.read()
+
+	if len(data) > 0xFFFF:
+		parser.error('the input must be smaller than 64KB')
+
+	compressed = compress(data, arguments.window_bits)
+
+	# Verify the round trip before emitting anything
+	if decompress(compressed) != data:
+		sys.exit('internal error: round trip failed')
+
+	header = make_header(arguments.name, os.path.basename(arguments.input), data, compressed, arguments.window_bits)
+
+	if arguments.output is None:
+		sys.stdout.write(header)
+	else:
+		with open(arguments.output, 'w', newline = '') as file:
+			file.write(header)
+
+
+if __name__ == '__main__':
+	main()
\ No newline at end of file
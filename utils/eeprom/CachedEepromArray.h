@@ -0,0 +1,92 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+#include "CachedEepromReference.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// Represents an array of objects in eeprom,
+	/// read from and written to through an @ref EepromCache.
+	///
+	/// @details
+	/// Behaves like @ref EepromArray, except that writes to elements
+	/// only update the cache's copy in RAM and mark it dirty.
+	///
+	/// Usually created with @ref EepromCache::bind.
+	template<typename Type, size_t capacity, typename Cache>
+	class CachedEepromArray
+	{
+	public:
+		/// @brief
+		/// The type of the elements stored in the array.
+		using value_type = Type;
+
+		/// @brief
+		/// The unsigned integer type used for measuring the size of the array.
+		/// Also used to represent array indices.
+		using size_type = size_t;
+
+		/// @brief
+		/// The type of the cache that reads and writes are made through.
+		using cache_type = Cache;
+
+		/// @brief
+		/// The type that represents a reference to an array element.
+		using reference = CachedEepromReference<value_type, cache_type>;
+
+	private:
+		cache_type * cache;
+		value_type * elements;
+
+	public:
+		/// @brief
+		/// Constructs a @ref CachedEepromArray that refers to the provided array,
+		/// through the provided cache.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided pointer points to an array
+		/// within the region of eeprom held by the cache.
+		/// It is thus possible to construct an invalid @ref CachedEepromArray,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr CachedEepromArray(cache_type & cache, value_type * pointer) :
+			cache(&cache), elements(pointer)
+		{
+		}
+
+		/// @brief
+		/// Returns the number of elements in the array.
+		constexpr size_type size() const noexcept
+		{
+			return capacity;
+		}
+
+		/// @brief
+		/// Returns a reference to the first element.
+		reference front() const
+		{
+			return reference(*this->cache, this->elements[0]);
+		}
+
+		/// @brief
+		/// Returns a reference to the last element.
+		reference back() const
+		{
+			return reference(*this->cache, this->elements[capacity - 1]);
+		}
+
+		/// @brief
+		/// Returns a reference to the element at `index`.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing an `index` that is greater than or equal to the size
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		reference operator[](size_type index) const
+		{
+			return reference(*this->cache, this->elements[index]);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+namespace eeprom
+{
+	/// @brief
+	/// Represents a reference to an object in eeprom,
+	/// read from and written to through an @ref EepromCache.
+	///
+	/// @details
+	/// Behaves like @ref EepromReference, except that assignment
+	/// only updates the cache's copy in RAM and marks it dirty.
+	/// The value is written to eeprom when the cache is flushed.
+	///
+	/// Usually created with @ref EepromCache::bind.
+	template<typename Type, typename Cache>
+	class CachedEepromReference
+	{
+	public:
+		/// @brief
+		/// The type of the object referred to by this reference.
+		using value_type = Type;
+
+		/// @brief
+		/// The type of the cache that reads and writes are made through.
+		using cache_type = Cache;
+
+	private:
+		cache_type * cache;
+		value_type * pointer;
+
+	public:
+		/// @brief
+		/// Constructs a @ref CachedEepromReference that refers to the provided object,
+		/// through the provided cache.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided reference refers to an object
+		/// within the region of eeprom held by the cache.
+		/// It is thus possible to construct an invalid @ref CachedEepromReference,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr CachedEepromReference(cache_type & cache, value_type & object) :
+			cache(&cache), pointer(&object)
+		{
+		}
+
+		/// @brief
+		/// Updates the cached copy of the object.
+		///
+		/// @details
+		/// Only bytes that differ from the cached value are marked dirty.
+		CachedEepromReference & operator =(const value_type & value)
+		{
+			this->cache->write(*this->pointer, value);
+			return *this;
+		}
+
+		/// @brief
+		/// Returns the underlying raw pointer into eeprom.
+		///
+		/// @details
+		/// This operator is marked explicit to prevent its accidental use
+		/// and to discourage excessive intentional use.
+		explicit operator value_type *() const
+		{
+			return this->pointer;
+		}
+
+		/// @brief
+		/// Reads the object from the cache.
+		operator value_type() const
+		{
+			return this->cache->read(*this->pointer);
+		}
+	};
+}
\ No newline at end of file
@@ -3,8 +3,16 @@
 // For size_t, ptrdiff_t
 #include <stddef.h>
 
+// For uint8_t
+#include <stdint.h>
+
+// For eeprom_read_block, eeprom_update_block
+#include <avr/eeprom.h>
+
 #include "EepromReference.h"
 #include "EepromPointer.h"
+#include "WriteStatistics.h"
+#include "details/diff_details.h"
 
 namespace eeprom
 {
@@ -70,7 +78,7 @@ namespace eeprom
 		static constexpr size_type end_index = capacity;
 
 	private:
-		const value_type * elements;
+		value_type * elements;
 
 	public:
 		/// @brief
@@ -81,7 +89,7 @@ namespace eeprom
 		/// There is no way of verifying that the provided reference refers to an array in eeprom.
 		/// It is thus possible to construct an invalid @ref EepromArray,
 		/// which can lead to <strong>undefined behaviour</strong>.
-		constexpr EepromArray(const value_type (& array)[capacity]) :
+		constexpr EepromArray(value_type (& array)[capacity]) :
 			elements(&array[0])
 		{
 		}
@@ -94,13 +102,13 @@ namespace eeprom
 		/// This constructor is marked explicit to ensure that the conversion from
 		/// a raw pointer to a @slink{eeprom::EepromArray,EepromArray}
 		/// is clearly visible, and to prevent confusion between this overload
-		/// and @ref EepromArray(const value_type (& array)[capacity]).
+		/// and @ref EepromArray(value_type (& array)[capacity]).
 		///
 		/// @warning
 		/// There is no way of verifying that the provided pointer points to an array element in eeprom.
 		/// It is thus possible to construct an invalid @ref EepromArray,
 		/// which can lead to <strong>undefined behaviour</strong>.
-		constexpr explicit EepromArray(const value_type * pointer) :
+		constexpr explicit EepromArray(value_type * pointer) :
 			elements(pointer)
 		{
 		}
@@ -259,6 +267,55 @@ namespace eeprom
 		{
 			return const_iterator(&this->elements[end_index]);
 		}
+
+		/// @brief
+		/// Copies `count` elements, starting at index `first`, into `output`.
+		///
+		/// @details
+		/// Reads the elements as a single block,
+		/// which is considerably faster than reading them one at a time through iterators.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing a range that extends beyond the end of the array
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		void readRange(size_type first, size_type count, value_type * output) const
+		{
+			eeprom_read_block(output, &this->elements[first], count * sizeof(value_type));
+		}
+
+		/// @brief
+		/// Copies `count` elements from `input` into the array, starting at index `first`,
+		/// avoiding writing bytes that are already identical.
+		///
+		/// @details
+		/// Behaves like @ref writeEeprom, writing the elements as a single block.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing a range that extends beyond the end of the array
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		void writeRange(size_type first, size_type count, const value_type * input)
+		{
+			eeprom_update_block(input, &this->elements[first], count * sizeof(value_type));
+		}
+
+		/// @brief
+		/// Copies `count` elements from `input` into the array, starting at index `first`,
+		/// and reports how many bytes were written.
+		///
+		/// @details
+		/// Behaves like @ref updateEeprom,
+		/// comparing a chunk at a time and using the cheapest programming mode for each byte.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing a range that extends beyond the end of the array
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		WriteStatistics updateRange(size_type first, size_type count, const value_type * input)
+		{
+			return details::update_eeprom_diff(reinterpret_cast<uint8_t *>(&this->elements[first]), reinterpret_cast<const uint8_t *>(input), count * sizeof(value_type));
+		}
 	};
 
 	/// @brief
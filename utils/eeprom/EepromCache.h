@@ -0,0 +1,303 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+// For memcpy
+#include <string.h>
+
+// For eeprom_read_block, eeprom_update_block
+#include <avr/eeprom.h>
+
+#include "EepromReference.h"
+#include "EepromArray.h"
+#include "CachedEepromReference.h"
+#include "CachedEepromArray.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// Holds a copy of a region of eeprom in RAM,
+	/// so that writes can be collected and written to eeprom later.
+	///
+	/// @details
+	/// Each eeprom byte takes about 3.3ms to write, so writing a structure
+	/// field by field can stall a frame for tens of milliseconds.
+	/// Writes to the cache only change the copy in RAM
+	/// and mark the lines that actually changed as dirty.
+	/// @ref flush then writes every dirty line in one go,
+	/// whereas @ref flush_some writes a limited number of bytes per call,
+	/// so that the cost can be spread across several frames.
+	///
+	/// Flushing uses the same update semantics as @ref writeEeprom,
+	/// so bytes in a dirty line that are unchanged are not rewritten.
+	///
+	/// E.g.
+	/// ```
+	/// eeprom::EepromCache<sizeof(Settings)> cache(&settings);
+	///
+	/// auto volume = cache.bind(eeprom::makeEepromReference(settings.volume));
+	///
+	/// volume = 5;
+	///
+	/// // Once per frame
+	/// cache.flush_some(2);
+	/// ```
+	///
+	/// @tparam size_value
+	/// The number of bytes held by the cache.
+	///
+	/// @tparam line_size_value
+	/// The number of bytes tracked by each dirty flag.
+	/// Larger lines use less RAM for tracking, but flush at a coarser granularity.
+	template<size_t size_value, size_t line_size_value = 1>
+	class EepromCache
+	{
+		static_assert(size_value > 0, "EepromCache size must be greater than 0");
+		static_assert(line_size_value > 0, "EepromCache line size must be greater than 0");
+
+	public:
+		/// @brief
+		/// The unsigned integer type used for measuring sizes.
+		using size_type = size_t;
+
+	private:
+		static constexpr size_type line_count = ((size_value + line_size_value - 1) / line_size_value);
+		static constexpr size_type flag_bytes = ((line_count + 7) / 8);
+
+	private:
+		uint8_t * address;
+		size_type next_line;
+		uint8_t bytes[size_value];
+		uint8_t dirty_flags[flag_bytes];
+
+	public:
+		/// @brief
+		/// Constructs an @ref EepromCache that holds the `size_value` bytes
+		/// of eeprom starting at `address`, and reads them into RAM.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided pointer points to eeprom.
+		/// It is thus possible to construct an invalid @ref EepromCache,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		explicit EepromCache(void * address) :
+			address(static_cast<uint8_t *>(address)), next_line(0), bytes(), dirty_flags()
+		{
+			this->load();
+		}
+
+		/// @brief
+		/// Returns the number of bytes held by the cache.
+		constexpr size_type size() const noexcept
+		{
+			return size_value;
+		}
+
+		/// @brief
+		/// Returns the number of bytes tracked by each dirty flag.
+		constexpr size_type line_size() const noexcept
+		{
+			return line_size_value;
+		}
+
+		/// @brief
+		/// Returns `true` if `count` bytes starting at `pointer` are held by the cache,
+		/// otherwise returns `false`.
+		bool contains(const void * pointer, size_type count) const
+		{
+			const uint8_t * bytePointer = static_cast<const uint8_t *>(pointer);
+
+			return ((bytePointer >= this->address) && (count <= size_value) && ((bytePointer - this->address) <= static_cast<ptrdiff_t>(size_value - count)));
+		}
+
+		/// @brief
+		/// Returns `true` if any writes have yet to be flushed,
+		/// otherwise returns `false`.
+		bool dirty() const
+		{
+			for(size_type index = 0; index < flag_bytes; ++index)
+				if(this->dirty_flags[index] != 0)
+					return true;
+
+			return false;
+		}
+
+		/// @brief
+		/// Reads every byte from eeprom into the cache,
+		/// discarding any writes that have not been flushed.
+		void load()
+		{
+			eeprom_read_block(&this->bytes[0], this->address, size_value);
+
+			for(size_type index = 0; index < flag_bytes; ++index)
+				this->dirty_flags[index] = 0;
+
+			this->next_line = 0;
+		}
+
+		/// @brief
+		/// Reads an object from the cache.
+		///
+		/// @warning
+		/// `object` must be located in the region of eeprom held by the cache.
+		/// <em>Otherwise the result is <strong>undefined behaviour</strong></em>.
+		template<typename Type>
+		Type read(const Type & object) const
+		{
+			Type result;
+			memcpy(&result, &this->bytes[this->offset_of(&object)], sizeof(Type));
+			return result;
+		}
+
+		/// @brief
+		/// Writes an object to the cache,
+		/// marking the lines containing changed bytes as dirty.
+		///
+		/// @warning
+		/// `object` must be located in the region of eeprom held by the cache.
+		/// <em>Otherwise the result is <strong>undefined behaviour</strong></em>.
+		template<typename Type>
+		void write(Type & object, const Type & value)
+		{
+			const size_type offset = this->offset_of(&object);
+			const uint8_t * source = reinterpret_cast<const uint8_t *>(&value);
+
+			for(size_type index = 0; index < sizeof(Type); ++index)
+			{
+				if(this->bytes[offset + index] != source[index])
+				{
+					this->bytes[offset + index] = source[index];
+					this->mark_dirty((offset + index) / line_size_value);
+				}
+			}
+		}
+
+		/// @brief
+		/// Binds an @ref EepromReference to the cache,
+		/// so that reads and writes through the result use the cache.
+		///
+		/// @warning
+		/// The referenced object must be located in the region of eeprom held by the cache.
+		/// <em>Otherwise the result is <strong>undefined behaviour</strong></em>.
+		template<typename Type>
+		CachedEepromReference<Type, EepromCache> bind(EepromReference<Type> reference)
+		{
+			return CachedEepromReference<Type, EepromCache>(*this, *static_cast<Type *>(reference));
+		}
+
+		/// @brief
+		/// Binds an @ref EepromArray to the cache,
+		/// so that reads and writes through the result use the cache.
+		///
+		/// @warning
+		/// The array must be located in the region of eeprom held by the cache.
+		/// <em>Otherwise the result is <strong>undefined behaviour</strong></em>.
+		template<typename Type, size_t capacity>
+		CachedEepromArray<Type, capacity, EepromCache> bind(EepromArray<Type, capacity> array)
+		{
+			return CachedEepromArray<Type, capacity, EepromCache>(*this, static_cast<Type *>(array.data()));
+		}
+
+		/// @brief
+		/// Writes every dirty line to eeprom.
+		///
+		/// @return
+		/// The number of bytes in the lines that were flushed.
+		size_type flush()
+		{
+			size_type flushed = 0;
+
+			for(size_type line = 0; line < line_count; ++line)
+				if(this->is_dirty(line))
+					flushed += this->flush_line(line);
+
+			this->next_line = 0;
+
+			return flushed;
+		}
+
+		/// @brief
+		/// Writes dirty lines to eeprom until roughly `budget` bytes have been flushed,
+		/// continuing from where the previous call stopped.
+		///
+		/// @details
+		/// A line is only flushed if it fits in what remains of the budget,
+		/// except that at least one dirty line is flushed by each call,
+		/// so that progress is always made.
+		///
+		/// @return
+		/// The number of bytes in the lines that were flushed.
+		size_type flush_some(size_type budget)
+		{
+			size_type flushed = 0;
+
+			for(size_type checked = 0; checked < line_count; ++checked)
+			{
+				const size_type line = this->next_line;
+
+				if(this->is_dirty(line))
+				{
+					const size_type length = this->line_length(line);
+
+					if((flushed > 0) && ((flushed + length) > budget))
+						break;
+
+					flushed += this->flush_line(line);
+				}
+
+				this->next_line = ((line + 1) < line_count) ? (line + 1) : 0;
+
+				if(flushed >= budget)
+					break;
+			}
+
+			return flushed;
+		}
+
+	private:
+		size_type offset_of(const void * pointer) const
+		{
+			return static_cast<size_type>(static_cast<const uint8_t *>(pointer) - this->address);
+		}
+
+		static constexpr size_type line_length(size_type line)
+		{
+			return (((line + 1) * line_size_value) <= size_value) ?
+				line_size_value :
+				(size_value - (line * line_size_value));
+		}
+
+		bool is_dirty(size_type line) const
+		{
+			return ((this->dirty_flags[line / 8] & (1 << (line % 8))) != 0);
+		}
+
+		void mark_dirty(size_type line)
+		{
+			this->dirty_flags[line / 8] |= static_cast<uint8_t>(1 << (line % 8));
+		}
+
+		size_type flush_line(size_type line)
+		{
+			const size_type offset = (line * line_size_value);
+			const size_type length = line_length(line);
+
+			eeprom_update_block(&this->bytes[offset], &this->address[offset], length);
+
+			this->dirty_flags[line / 8] &= static_cast<uint8_t>(~(1 << (line % 8)));
+
+			return length;
+		}
+	};
+
+	// Definitions of the static data members, as required by C++11
+
+	template<size_t size_value, size_t line_size_value>
+	constexpr typename EepromCache<size_value, line_size_value>::size_type EepromCache<size_value, line_size_value>::line_count;
+
+	template<size_t size_value, size_t line_size_value>
+	constexpr typename EepromCache<size_value, line_size_value>::size_type EepromCache<size_value, line_size_value>::flag_bytes;
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+#include "EepromReference.h"
+#include "EepromPointer.h"
+
+// For utils::gridIndex
+#include "../utils/gridIndex.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// An iterator over the elements of a column of a @ref EepromGrid,
+	/// which advances by a whole row at a time.
+	template<typename Type, size_t stride>
+	class EepromColumnIterator
+	{
+	public:
+		/// @brief
+		/// The type of the elements.
+		using value_type = Type;
+
+		/// @brief
+		/// The signed integer type used for measuring the distance between elements.
+		using difference_type = ptrdiff_t;
+
+	private:
+		// The first element of the column, and the row the iterator refers to.
+		// Only the current element's address is ever computed,
+		// so the end iterator never forms a pointer beyond the array.
+		value_type * column;
+		size_t row;
+
+	public:
+		/// @brief
+		/// Constructs an iterator referring to row `row` of the column
+		/// whose first element is pointed to by `column`.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided pointer points to an array element in eeprom.
+		/// It is thus possible to construct an invalid @ref EepromColumnIterator,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr EepromColumnIterator(value_type * column, size_t row) :
+			column(column), row(row)
+		{
+		}
+
+		/// @brief
+		/// Returns a pointer to the element the iterator refers to.
+		///
+		/// @warning
+		/// Do not call this function on a past-the-end iterator.
+		/// <em>Doing so will result in <strong>undefined behaviour</strong></em>.
+		constexpr EepromPointer<value_type> base() const
+		{
+			return EepromPointer<value_type>(&this->column[utils::gridIndex<stride>(0, this->row)]);
+		}
+
+		constexpr EepromReference<value_type> operator *() const
+		{
+			return EepromReference<value_type>(&this->column[utils::gridIndex<stride>(0, this->row)]);
+		}
+
+		EepromColumnIterator & operator ++()
+		{
+			++this->row;
+			return *this;
+		}
+
+		EepromColumnIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+
+		EepromColumnIterator & operator --()
+		{
+			--this->row;
+			return *this;
+		}
+
+		EepromColumnIterator operator --(int)
+		{
+			auto result = *this;
+			this->operator--();
+			return result;
+		}
+
+		friend constexpr bool operator ==(const EepromColumnIterator & left, const EepromColumnIterator & right)
+		{
+			return ((left.column == right.column) && (left.row == right.row));
+		}
+
+		friend constexpr bool operator !=(const EepromColumnIterator & left, const EepromColumnIterator & right)
+		{
+			return ((left.column != right.column) || (left.row != right.row));
+		}
+	};
+}
\ No newline at end of file
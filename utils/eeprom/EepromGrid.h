@@ -0,0 +1,309 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+// For utils::gridIndex
+#include "../utils/gridIndex.h"
+
+// For utils::IteratorPair
+#include "../utils/Iterator/IteratorPair.h"
+
+#include "EepromReference.h"
+#include "EepromPointer.h"
+#include "EepromArray.h"
+#include "EepromColumnIterator.h"
+#include "specialisations/EepromReference_const.h"
+#include "specialisations/EepromPointer_const.h"
+#include "specialisations/EepromArray_const.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// Represents a two-dimensional array of objects stored in eeprom.
+	///
+	/// @details
+	/// The elements are stored in row-major order,
+	/// exactly as in a plain two-dimensional array `Type[height][width]`,
+	/// so an existing array can be used without modification.
+	///
+	/// When `width` is a power of two, the row offset
+	/// is computed with a shift rather than a multiplication.
+	///
+	/// E.g.
+	/// ```
+	/// eeprom::EepromGrid<uint8_t, 16, 4> scores(*reinterpret_cast<uint8_t (*)[4][16]>(address));
+	///
+	/// scores(x, y) = 10;
+	///
+	/// for(auto score : scores.column(x))
+	/// 	...
+	/// ```
+	template<typename Type, size_t width_value, size_t height_value>
+	class EepromGrid
+	{
+		static_assert(width_value > 0, "EepromGrid width must be greater than 0");
+		static_assert(height_value > 0, "EepromGrid height must be greater than 0");
+
+	public:
+		/// @brief
+		/// The type of the elements stored in the grid.
+		using value_type = Type;
+
+		/// @brief
+		/// The unsigned integer type used for measuring the size of the grid.
+		/// Also used to represent coordinates.
+		using size_type = size_t;
+
+		/// @brief
+		/// The signed integer type used for measuring the distance between elements.
+		using difference_type = ptrdiff_t;
+
+		/// @brief
+		/// The type that represents a reference to an element.
+		using reference = EepromReference<value_type>;
+
+		/// @brief
+		/// The type that represents a reference to a read-only element.
+		using const_reference = EepromReference<const value_type>;
+
+		/// @brief
+		/// The type that represents a pointer to an element.
+		using pointer = EepromPointer<value_type>;
+
+		/// @brief
+		/// The type that represents a pointer to a read-only element.
+		using const_pointer = EepromPointer<const value_type>;
+
+		/// @brief
+		/// The type used as an iterator over every element, in row-major order.
+		using iterator = pointer;
+
+		/// @brief
+		/// The type used as an iterator over every read-only element, in row-major order.
+		using const_iterator = const_pointer;
+
+		/// @brief
+		/// The type that represents a single row.
+		using row_type = EepromArray<value_type, width_value>;
+
+		/// @brief
+		/// The type that represents a single read-only row.
+		using const_row_type = EepromArray<const value_type, width_value>;
+
+		/// @brief
+		/// The type used as an iterator over a single column.
+		using column_iterator = EepromColumnIterator<value_type, width_value>;
+
+		/// @brief
+		/// The type used as an iterator over a single read-only column.
+		using const_column_iterator = EepromColumnIterator<const value_type, width_value>;
+
+		/// @brief
+		/// The type that represents a single column.
+		using column_type = utils::IteratorPair<column_iterator>;
+
+		/// @brief
+		/// The type that represents a single read-only column.
+		using const_column_type = utils::IteratorPair<const_column_iterator>;
+
+	private:
+		value_type * elements;
+
+	public:
+		/// @brief
+		/// Constructs an @ref EepromGrid that refers to the provided two-dimensional array.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided reference refers to an array in eeprom.
+		/// It is thus possible to construct an invalid @ref EepromGrid,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr EepromGrid(value_type (& array)[height_value][width_value]) :
+			elements(&array[0][0])
+		{
+		}
+
+		/// @brief
+		/// Constructs an @ref EepromGrid that refers to the provided flat array.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided reference refers to an array in eeprom.
+		/// It is thus possible to construct an invalid @ref EepromGrid,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr EepromGrid(value_type (& array)[width_value * height_value]) :
+			elements(&array[0])
+		{
+		}
+
+		/// @brief
+		/// Constructs an @ref EepromGrid that takes on the value of the provided pointer.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided pointer points to an array in eeprom.
+		/// It is thus possible to construct an invalid @ref EepromGrid,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr explicit EepromGrid(value_type * pointer) :
+			elements(pointer)
+		{
+		}
+
+		/// @brief
+		/// Returns the number of columns.
+		constexpr size_type width() const noexcept
+		{
+			return width_value;
+		}
+
+		/// @brief
+		/// Returns the number of rows.
+		constexpr size_type height() const noexcept
+		{
+			return height_value;
+		}
+
+		/// @brief
+		/// Returns the total number of elements.
+		constexpr size_type size() const noexcept
+		{
+			return (width_value * height_value);
+		}
+
+		/// @brief
+		/// Returns a pointer to the first element.
+		pointer data() noexcept
+		{
+			return pointer(this->elements);
+		}
+
+		/// @brief
+		/// Returns a pointer to the first element.
+		constexpr const_pointer data() const noexcept
+		{
+			return const_pointer(this->elements);
+		}
+
+		/// @brief
+		/// Returns a reference to the element at (`x`, `y`).
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing an `x` that is greater than or equal to the width,
+		/// or a `y` that is greater than or equal to the height,
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		reference operator()(size_type x, size_type y)
+		{
+			return reference(&this->elements[utils::gridIndex<width_value>(x, y)]);
+		}
+
+		/// @brief
+		/// Returns a read-only reference to the element at (`x`, `y`).
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing an `x` that is greater than or equal to the width,
+		/// or a `y` that is greater than or equal to the height,
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		constexpr const_reference operator()(size_type x, size_type y) const
+		{
+			return const_reference(&this->elements[utils::gridIndex<width_value>(x, y)]);
+		}
+
+		/// @brief
+		/// Returns an @ref EepromArray that refers to row `y`.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		row_type row(size_type y)
+		{
+			return row_type(&this->elements[utils::gridIndex<width_value>(0, y)]);
+		}
+
+		/// @brief
+		/// Returns a read-only @ref EepromArray that refers to row `y`.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		constexpr const_row_type row(size_type y) const
+		{
+			return const_row_type(&this->elements[utils::gridIndex<width_value>(0, y)]);
+		}
+
+		/// @brief
+		/// Returns a range of the elements in column `x`, from top to bottom.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		column_type column(size_type x)
+		{
+			return column_type
+			(
+				column_iterator(&this->elements[x], 0),
+				column_iterator(&this->elements[x], height_value)
+			);
+		}
+
+		/// @brief
+		/// Returns a range of the read-only elements in column `x`, from top to bottom.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		const_column_type column(size_type x) const
+		{
+			return const_column_type
+			(
+				const_column_iterator(&this->elements[x], 0),
+				const_column_iterator(&this->elements[x], height_value)
+			);
+		}
+
+		/// @brief
+		/// Returns an iterator pointing to the first element, in row-major order.
+		iterator begin() noexcept
+		{
+			return iterator(&this->elements[0]);
+		}
+
+		/// @brief
+		/// Returns a const iterator pointing to the first element, in row-major order.
+		constexpr const_iterator begin() const noexcept
+		{
+			return const_iterator(&this->elements[0]);
+		}
+
+		/// @brief
+		/// Returns a past-the-end iterator pointing beyond the last element.
+		///
+		/// @warning
+		/// Do not attempt to dereference the returned iterator.
+		/// <em>Doing so will result in <strong>undefined behaviour</strong></em>.
+		iterator end() noexcept
+		{
+			return iterator(&this->elements[width_value * height_value]);
+		}
+
+		/// @brief
+		/// Returns a past-the-end const iterator pointing beyond the last element.
+		///
+		/// @warning
+		/// Do not attempt to dereference the returned iterator.
+		/// <em>Doing so will result in <strong>undefined behaviour</strong></em>.
+		constexpr const_iterator end() const noexcept
+		{
+			return const_iterator(&this->elements[width_value * height_value]);
+		}
+	};
+
+	/// @brief
+	/// A simpler way to construct an @ref EepromGrid.
+	/// This function allows the type and dimensions to be inferred.
+	///
+	/// @warning
+	/// There is no way of verifying that the provided reference refers to an array in eeprom.
+	/// It is thus possible to construct an invalid @ref EepromGrid,
+	/// which can lead to <strong>undefined behaviour</strong>.
+	template<typename Type, size_t width, size_t height>
+	constexpr EepromGrid<Type, width, height> makeEepromGrid(Type (& array)[height][width])
+	{
+		return array;
+	}
+}
\ No newline at end of file
@@ -1,6 +1,11 @@
 #pragma once
 
+// For uint8_t
+#include <stdint.h>
+
 #include "readEeprom.h"
+#include "writeEeprom.h"
+#include "details/diff_details.h"
 
 namespace eeprom
 {
@@ -19,6 +24,9 @@ namespace eeprom
 	/// * Secondarily, the intent of this class is to provide
 	/// a functional analogue to references for objects in eeprom,
 	/// as regular references don't work for objects stored in eeprom.  
+	///
+	/// The compound assignment, increment and decrement operators
+	/// read the object once, then write only the bytes that changed.
 	template<typename Type>
 	class EepromReference
 	{
@@ -28,7 +36,7 @@ namespace eeprom
 		using value_type = Type;
 
 	private:
-		const value_type * pointer;
+		value_type * pointer;
 
 	public:
 		/// @brief
@@ -123,6 +131,164 @@ namespace eeprom
 		{
 			return eeprom::readEeprom(*this->pointer);
 		}
+
+		/// @brief
+		/// Adds `value` to the object in eeprom.
+		template<typename Other>
+		EepromReference & operator +=(const Other & value)
+		{
+			this->modify([&value](value_type & object) { object += value; });
+			return *this;
+		}
+
+		/// @brief
+		/// Subtracts `value` from the object in eeprom.
+		template<typename Other>
+		EepromReference & operator -=(const Other & value)
+		{
+			this->modify([&value](value_type & object) { object -= value; });
+			return *this;
+		}
+
+		/// @brief
+		/// Multiplies the object in eeprom by `value`.
+		template<typename Other>
+		EepromReference & operator *=(const Other & value)
+		{
+			this->modify([&value](value_type & object) { object *= value; });
+			return *this;
+		}
+
+		/// @brief
+		/// Divides the object in eeprom by `value`.
+		template<typename Other>
+		EepromReference & operator /=(const Other & value)
+		{
+			this->modify([&value](value_type & object) { object /= value; });
+			return *this;
+		}
+
+		/// @brief
+		/// Replaces the object in eeprom with the remainder of dividing it by `value`.
+		template<typename Other>
+		EepromReference & operator %=(const Other & value)
+		{
+			this->modify([&value](value_type & object) { object %= value; });
+			return *this;
+		}
+
+		/// @brief
+		/// Performs a bitwise and of the object in eeprom with `value`.
+		template<typename Other>
+		EepromReference & operator &=(const Other & value)
+		{
+			this->modify([&value](value_type & object) { object &= value; });
+			return *this;
+		}
+
+		/// @brief
+		/// Performs a bitwise or of the object in eeprom with `value`.
+		template<typename Other>
+		EepromReference & operator |=(const Other & value)
+		{
+			this->modify([&value](value_type & object) { object |= value; });
+			return *this;
+		}
+
+		/// @brief
+		/// Performs a bitwise exclusive or of the object in eeprom with `value`.
+		template<typename Other>
+		EepromReference & operator ^=(const Other & value)
+		{
+			this->modify([&value](value_type & object) { object ^= value; });
+			return *this;
+		}
+
+		/// @brief
+		/// Shifts the object in eeprom left by `value` bits.
+		template<typename Other>
+		EepromReference & operator <<=(const Other & value)
+		{
+			this->modify([&value](value_type & object) { object <<= value; });
+			return *this;
+		}
+
+		/// @brief
+		/// Shifts the object in eeprom right by `value` bits.
+		template<typename Other>
+		EepromReference & operator >>=(const Other & value)
+		{
+			this->modify([&value](value_type & object) { object >>= value; });
+			return *this;
+		}
+
+		/// @brief
+		/// Increments the object in eeprom.
+		EepromReference & operator ++()
+		{
+			this->modify([](value_type & object) { ++object; });
+			return *this;
+		}
+
+		/// @brief
+		/// Decrements the object in eeprom.
+		EepromReference & operator --()
+		{
+			this->modify([](value_type & object) { --object; });
+			return *this;
+		}
+
+		/// @brief
+		/// Increments the object in eeprom, returning its previous value.
+		value_type operator ++(int)
+		{
+			return this->modify([](value_type & object) { ++object; });
+		}
+
+		/// @brief
+		/// Decrements the object in eeprom, returning its previous value.
+		value_type operator --(int)
+		{
+			return this->modify([](value_type & object) { --object; });
+		}
+
+		/// @brief
+		/// Returns an @ref EepromReference to a member of the object in eeprom.
+		///
+		/// @details
+		/// Reading or writing through the returned reference
+		/// only accesses the bytes of that member.
+		///
+		/// E.g.
+		/// ```
+		/// auto save = eeprom::makeEepromReference(*reinterpret_cast<Save *>(address));
+		///
+		/// save.member(&Save::score) += 10;
+		/// ```
+		template<typename Member, typename Class>
+		EepromReference<Member> member(Member Class::* member) const
+		{
+			return EepromReference<Member>(&(this->pointer->*member));
+		}
+
+	private:
+		// Reads the object once and applies 'function' to a copy of it,
+		// then compares against the value already read, so eeprom isn't read again.
+		// Returns the previous value.
+		template<typename Function>
+		value_type modify(Function function)
+		{
+			const value_type old_value = eeprom::readEeprom(*this->pointer);
+
+			value_type new_value = old_value;
+			function(new_value);
+
+			value_type shadow = old_value;
+
+			details::update_eeprom_shadow(reinterpret_cast<uint8_t *>(this->pointer), reinterpret_cast<const uint8_t *>(&new_value), reinterpret_cast<uint8_t *>(&shadow), sizeof(value_type));
+
+			return old_value;
+		}
 	};
 
 	/// @brief
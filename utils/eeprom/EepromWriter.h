@@ -0,0 +1,26 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For eeprom_update_block
+#include <avr/eeprom.h>
+
+namespace eeprom
+{
+	/// @brief
+	/// The default way that classes such as @ref Transactional write to eeprom.
+	///
+	/// @details
+	/// Avoids writing bytes that are already identical, as @ref writeEeprom does.
+	///
+	/// A different writer with the same static `write` function may be provided instead,
+	/// e.g. to simulate power being lost partway through a write when testing.
+	struct EepromWriter
+	{
+		static void write(void * destination, const void * source, size_t size)
+		{
+			eeprom_update_block(source, destination, size);
+		}
+	};
+}
\ No newline at end of file
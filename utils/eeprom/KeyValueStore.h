@@ -0,0 +1,479 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For memcmp
+#include <string.h>
+
+// For eeprom_read_byte, eeprom_read_block
+#include <avr/eeprom.h>
+
+#include "EepromWriter.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// Stores values by key in a region of eeprom,
+	/// as a log of records that is only ever appended to.
+	///
+	/// @details
+	/// Each record holds a key, the size of its value, and the value itself.
+	/// Setting a key appends a new record rather than rewriting the old one,
+	/// which spreads wear across the region
+	/// and means that a new key can be added without moving any existing data.
+	/// The region is split into two banks, only one of which holds the log at a time.
+	/// Once the log is full, @ref compact copies the latest record of each key
+	/// into the other bank, discarding older records.
+	///
+	/// On construction, the log is scanned once to build an index in RAM
+	/// that maps each key to its latest record,
+	/// so reads after startup take `O(1)` time.
+	/// The index is an open-addressing hash table of `key_capacity` entries,
+	/// each taking 3 bytes of RAM.
+	///
+	/// A record's key is written after the rest of the record,
+	/// so if power is lost while setting a value, the previous value is kept.
+	/// Each bank starts with a generation counter,
+	/// which compaction writes only after every record has been copied,
+	/// so if power is lost while compacting, the old bank is still used.
+	///
+	/// The end of the log is marked by a key of `0xFF`,
+	/// and a generation of `0xFF` marks an unused bank,
+	/// so erased eeprom is an empty store.
+	/// Eeprom that holds other data must be cleared with @ref clear before use.
+	///
+	/// E.g.
+	/// ```
+	/// eeprom::KeyValueStore<256, 16> store(reinterpret_cast<void *>(512));
+	///
+	/// uint8_t volume = 3;
+	/// store.get(volumeKey, volume);
+	///
+	/// store.set(volumeKey, static_cast<uint8_t>(volume + 1));
+	/// ```
+	///
+	/// @tparam region_size
+	/// The number of bytes of eeprom used by the store.
+	/// Each bank takes half, so at most `(region_size / 2) - 1` bytes of records are stored.
+	///
+	/// @tparam key_capacity
+	/// The maximum number of distinct keys.
+	///
+	/// @tparam Writer
+	/// The type used to write to eeprom. See @ref EepromWriter.
+	template<size_t region_size, size_t key_capacity, typename Writer = EepromWriter>
+	class KeyValueStore
+	{
+		static_assert(region_size >= 8, "KeyValueStore region must be at least 8 bytes");
+		static_assert(region_size < 0xFFFF, "KeyValueStore region must be smaller than 65535 bytes");
+		static_assert(key_capacity > 0, "KeyValueStore must allow at least 1 key");
+
+	public:
+		/// @brief
+		/// The type of the keys.
+		/// `0xFF` is reserved to mark the end of the log.
+		using key_type = uint8_t;
+
+		/// @brief
+		/// The unsigned integer type used for measuring sizes.
+		using size_type = size_t;
+
+		/// @brief
+		/// The key that marks the end of the log, which may not be used as a key.
+		static constexpr key_type end_key = 0xFF;
+
+		/// @brief
+		/// The largest value that can be stored.
+		static constexpr size_type max_value_size = 0xFE;
+
+	private:
+		static constexpr uint16_t removed_offset = 0xFFFF;
+		static constexpr size_type header_size = 2;
+		static constexpr size_type bank_size = (region_size / 2);
+		static constexpr size_type log_capacity = (bank_size - 1);
+		static constexpr uint8_t unused_generation = 0xFF;
+
+		struct index_entry
+		{
+			key_type key;
+			uint16_t offset;
+		};
+
+	private:
+		uint8_t * region;
+		uint8_t * log;
+		uint8_t generation;
+		uint16_t log_end;
+		index_entry index[key_capacity];
+
+	public:
+		/// @brief
+		/// Constructs a @ref KeyValueStore that uses `region_size` bytes of eeprom
+		/// starting at `address`, and scans the log to build the index.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided pointer points to eeprom.
+		/// It is thus possible to construct an invalid @ref KeyValueStore,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		explicit KeyValueStore(void * address) :
+			region(static_cast<uint8_t *>(address)), log(nullptr), generation(unused_generation), log_end(0), index()
+		{
+			this->scan();
+		}
+
+		/// @brief
+		/// Finds the newest bank and rebuilds the index by scanning its log from the start.
+		///
+		/// @details
+		/// This is done on construction, so only needs to be called
+		/// if the region is written by something else.
+		void scan()
+		{
+			const uint8_t first = eeprom_read_byte(this->bank(0));
+			const uint8_t second = eeprom_read_byte(this->bank(1));
+
+			// Generations wrap around, so compare them by their difference
+			const bool use_second = (second != unused_generation) && ((first == unused_generation) || (static_cast<int8_t>(second - first) > 0));
+
+			this->generation = use_second ? second : first;
+			this->log = (this->bank(use_second ? 1 : 0) + 1);
+
+			this->clear_index();
+
+			size_type offset = 0;
+
+			while((offset + header_size) <= log_capacity)
+			{
+				const key_type key = eeprom_read_byte(&this->log[offset]);
+
+				if(key == end_key)
+					break;
+
+				const uint8_t length = eeprom_read_byte(&this->log[offset + 1]);
+
+				// A record that runs past the bank can only be corrupt
+				if((offset + header_size + length) > log_capacity)
+					break;
+
+				if(!this->index_record(key, (length > 0) ? static_cast<uint16_t>(offset) : removed_offset))
+					break;
+
+				offset += (header_size + length);
+			}
+
+			this->log_end = static_cast<uint16_t>(offset);
+		}
+
+		/// @brief
+		/// Returns the number of bytes used by the log.
+		size_type used() const
+		{
+			return this->log_end;
+		}
+
+		/// @brief
+		/// Returns the number of bytes that can still be appended to the log
+		/// before it must be compacted.
+		size_type available() const
+		{
+			return (log_capacity - this->log_end);
+		}
+
+		/// @brief
+		/// Returns `true` if `key` has a value, otherwise returns `false`.
+		bool contains(key_type key) const
+		{
+			const index_entry * entry = this->find(key);
+
+			return ((entry != nullptr) && (entry->offset != removed_offset));
+		}
+
+		/// @brief
+		/// Reads the value of `key` into `value`.
+		///
+		/// @return
+		/// `true` if `key` has a value of the same size as `Type`,
+		/// otherwise `false`, in which case `value` is unchanged.
+		template<typename Type>
+		bool get(key_type key, Type & value) const
+		{
+			const index_entry * entry = this->find(key);
+
+			if((entry == nullptr) || (entry->offset == removed_offset))
+				return false;
+
+			if(eeprom_read_byte(&this->log[entry->offset + 1]) != sizeof(Type))
+				return false;
+
+			eeprom_read_block(&value, &this->log[entry->offset + header_size], sizeof(Type));
+			return true;
+		}
+
+		/// @brief
+		/// Sets the value of `key` by appending a record to the log,
+		/// compacting the log first if there isn't room.
+		///
+		/// @details
+		/// Nothing is written if `key` already has an identical value.
+		///
+		/// @return
+		/// `true` if the value was stored, or `false` if there is no room for it,
+		/// or if `key` is new and the index is full.
+		template<typename Type>
+		bool set(key_type key, const Type & value)
+		{
+			static_assert(sizeof(Type) <= max_value_size, "KeyValueStore values must be smaller than 255 bytes");
+
+			if(key == end_key)
+				return false;
+
+			Type current;
+
+			if(this->get(key, current) && (memcmp(&current, &value, sizeof(Type)) == 0))
+				return true;
+
+			return this->append(key, &value, sizeof(Type));
+		}
+
+		/// @brief
+		/// Removes the value of `key` by appending a record to the log.
+		///
+		/// @return
+		/// `true` if `key` no longer has a value,
+		/// or `false` if there was no room to record its removal.
+		bool remove(key_type key)
+		{
+			if(!this->contains(key))
+				return true;
+
+			return this->append(key, nullptr, 0);
+		}
+
+		/// @brief
+		/// Copies the latest record of each key into the other bank,
+		/// discarding older records and removed keys.
+		///
+		/// @details
+		/// The other bank is only used once every record has been copied,
+		/// so if power is lost during compaction, the store is unchanged.
+		void compact()
+		{
+			const uint8_t next_generation = next(this->generation);
+			uint8_t * const target_bank = this->other_bank();
+			uint8_t * const target = (target_bank + 1);
+
+			size_type destination = 0;
+
+			for(size_type slot = 0; slot < key_capacity; ++slot)
+			{
+				index_entry & entry = this->index[slot];
+
+				if(entry.key == end_key)
+					continue;
+
+				// Removed keys no longer have records
+				if(entry.offset == removed_offset)
+				{
+					entry.key = end_key;
+					continue;
+				}
+
+				const size_type length = (header_size + eeprom_read_byte(&this->log[entry.offset + 1]));
+
+				for(size_type index = 0; index < length; ++index)
+					write_byte(&target[destination + index], eeprom_read_byte(&this->log[entry.offset + index]));
+
+				entry.offset = static_cast<uint16_t>(destination);
+				destination += length;
+			}
+
+			if(destination < log_capacity)
+				write_byte(&target[destination], end_key);
+
+			// Writing the generation last switches to the new bank in a single byte
+			write_byte(target_bank, next_generation);
+
+			this->rehash();
+
+			this->log = target;
+			this->generation = next_generation;
+			this->log_end = static_cast<uint16_t>(destination);
+		}
+
+		/// @brief
+		/// Removes every key.
+		void clear()
+		{
+			// The other bank must not be mistaken for a newer one
+			write_byte(this->other_bank(), unused_generation);
+			write_byte(&this->log[0], end_key);
+
+			this->clear_index();
+			this->log_end = 0;
+		}
+
+	private:
+		uint8_t * bank(size_type which) const
+		{
+			return &this->region[which * bank_size];
+		}
+
+		uint8_t * other_bank() const
+		{
+			return (this->log == (this->bank(0) + 1)) ? this->bank(1) : this->bank(0);
+		}
+
+		static void write_byte(uint8_t * destination, uint8_t value)
+		{
+			Writer::write(destination, &value, sizeof(value));
+		}
+
+		// Skips the generation that marks an unused bank
+		static uint8_t next(uint8_t generation)
+		{
+			const uint8_t result = static_cast<uint8_t>(generation + 1);
+			return (result != unused_generation) ? result : 0;
+		}
+
+		static size_type home_slot(key_type key)
+		{
+			// Fibonacci hashing spreads consecutive keys apart
+			return (static_cast<uint8_t>(key * 157u) % key_capacity);
+		}
+
+		void clear_index()
+		{
+			for(size_type slot = 0; slot < key_capacity; ++slot)
+				this->index[slot] = index_entry { end_key, removed_offset };
+		}
+
+		const index_entry * find(key_type key) const
+		{
+			size_type slot = home_slot(key);
+
+			for(size_type probe = 0; probe < key_capacity; ++probe)
+			{
+				const index_entry & entry = this->index[slot];
+
+				if(entry.key == key)
+					return &entry;
+
+				if(entry.key == end_key)
+					return nullptr;
+
+				slot = ((slot + 1) < key_capacity) ? (slot + 1) : 0;
+			}
+
+			return nullptr;
+		}
+
+		// Records the latest offset of 'key', returning false if the index is full
+		bool index_record(key_type key, uint16_t offset)
+		{
+			size_type slot = home_slot(key);
+
+			for(size_type probe = 0; probe < key_capacity; ++probe)
+			{
+				index_entry & entry = this->index[slot];
+
+				if((entry.key == key) || (entry.key == end_key))
+				{
+					entry = index_entry { key, offset };
+					return true;
+				}
+
+				slot = ((slot + 1) < key_capacity) ? (slot + 1) : 0;
+			}
+
+			return false;
+		}
+
+		// Reinserts every entry, after entries have been removed from the table
+		void rehash()
+		{
+			index_entry entries[key_capacity];
+
+			for(size_type slot = 0; slot < key_capacity; ++slot)
+				entries[slot] = this->index[slot];
+
+			this->clear_index();
+
+			for(size_type slot = 0; slot < key_capacity; ++slot)
+				if(entries[slot].key != end_key)
+					this->index_record(entries[slot].key, entries[slot].offset);
+		}
+
+		bool has_room(size_type size) const
+		{
+			return ((this->log_end + header_size + size) <= log_capacity);
+		}
+
+		bool append(key_type key, const void * value, size_type size)
+		{
+			const bool indexed = (this->find(key) != nullptr);
+
+			// Compaction frees both log space and the index entries of removed keys
+			if(!this->has_room(size) || (!indexed && !this->index_has_space()))
+				this->compact();
+
+			if(!this->has_room(size) || ((this->find(key) == nullptr) && !this->index_has_space()))
+				return false;
+
+			const size_type offset = this->log_end;
+			const size_type end = (offset + header_size + size);
+
+			// The new end of the log is marked before the record is written,
+			// and the record's key is written last, so a partial record is never read
+			if(end < log_capacity)
+				write_byte(&this->log[end], end_key);
+
+			write_byte(&this->log[offset + 1], static_cast<uint8_t>(size));
+
+			if(size > 0)
+				Writer::write(&this->log[offset + header_size], value, size);
+
+			write_byte(&this->log[offset], key);
+
+			this->index_record(key, (size > 0) ? static_cast<uint16_t>(offset) : removed_offset);
+			this->log_end = static_cast<uint16_t>(end);
+
+			return true;
+		}
+
+		bool index_has_space() const
+		{
+			for(size_type slot = 0; slot < key_capacity; ++slot)
+				if(this->index[slot].key == end_key)
+					return true;
+
+			return false;
+		}
+	};
+
+	// Definitions of the static data members, as required by C++11
+
+	template<size_t region_size, size_t key_capacity, typename Writer>
+	constexpr typename KeyValueStore<region_size, key_capacity, Writer>::key_type KeyValueStore<region_size, key_capacity, Writer>::end_key;
+
+	template<size_t region_size, size_t key_capacity, typename Writer>
+	constexpr typename KeyValueStore<region_size, key_capacity, Writer>::size_type KeyValueStore<region_size, key_capacity, Writer>::max_value_size;
+
+	template<size_t region_size, size_t key_capacity, typename Writer>
+	constexpr uint16_t KeyValueStore<region_size, key_capacity, Writer>::removed_offset;
+
+	template<size_t region_size, size_t key_capacity, typename Writer>
+	constexpr typename KeyValueStore<region_size, key_capacity, Writer>::size_type KeyValueStore<region_size, key_capacity, Writer>::header_size;
+
+	template<size_t region_size, size_t key_capacity, typename Writer>
+	constexpr typename KeyValueStore<region_size, key_capacity, Writer>::size_type KeyValueStore<region_size, key_capacity, Writer>::bank_size;
+
+	template<size_t region_size, size_t key_capacity, typename Writer>
+	constexpr typename KeyValueStore<region_size, key_capacity, Writer>::size_type KeyValueStore<region_size, key_capacity, Writer>::log_capacity;
+
+	template<size_t region_size, size_t key_capacity, typename Writer>
+	constexpr uint8_t KeyValueStore<region_size, key_capacity, Writer>::unused_generation;
+}
\ No newline at end of file
@@ -0,0 +1,197 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint16_t, uint32_t, uintptr_t
+#include <stdint.h>
+
+// For E2END
+#include <avr/io.h>
+
+#include "readEeprom.h"
+#include "writeEeprom.h"
+#include "details/layout_details.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// Describes a field of a @ref Layout.
+	///
+	/// @details
+	/// Each field of a layout is named by a distinct type derived from @ref LayoutField,
+	/// which is used to look up the field's offset and handle.
+	///
+	/// E.g.
+	/// ```
+	/// struct Settings : eeprom::LayoutField<SettingsData, 1> {};
+	/// struct HighScores : eeprom::LayoutField<uint16_t[10], 2, 2> {};
+	/// ```
+	///
+	/// @tparam Type
+	/// The type of object stored in the field.
+	/// Array types produce an @ref EepromArray handle,
+	/// while any other type produces an @ref EepromReference handle.
+	///
+	/// @tparam identifier_value
+	/// A number that identifies the field within its layout, which is included in the layout's hash.
+	/// The type of a field can't be included in the hash,
+	/// so the identifier must be changed whenever the type or meaning of the field changes.
+	///
+	/// @tparam alignment_value
+	/// The offset of the field is rounded up to a multiple of this.
+	template<typename Type, uint16_t identifier_value, size_t alignment_value = 1>
+	struct LayoutField
+	{
+		static_assert(alignment_value > 0, "LayoutField alignment must be greater than 0");
+
+		/// @brief
+		/// The type of object stored in the field.
+		using value_type = Type;
+
+		/// @brief
+		/// The number that identifies the field.
+		static constexpr uint16_t identifier = identifier_value;
+
+		/// @brief
+		/// The size of the field, in bytes.
+		static constexpr size_t size = sizeof(Type);
+
+		/// @brief
+		/// The alignment of the field, in bytes.
+		static constexpr size_t alignment = alignment_value;
+	};
+
+	/// @brief
+	/// Assigns each field an offset in eeprom at compile time,
+	/// so that fields never overlap and addresses are never written by hand.
+	///
+	/// @details
+	/// Fields are placed in order, starting after a 4-byte hash of the layout,
+	/// each at the next offset that satisfies its alignment.
+	///
+	/// The hash is computed from the identifier, offset and size of every field, in order,
+	/// so adding, removing, reordering or resizing fields changes the hash,
+	/// as does changing the identifier of a field whose type has changed.
+	/// Storing it with @ref stamp and checking it with @ref valid
+	/// lets the stored data be validated at startup with a single read.
+	///
+	/// The layout is checked at compile time to fit within eeprom.
+	/// Another layout may follow it by starting at its @ref end.
+	///
+	/// E.g.
+	/// ```
+	/// struct Settings : eeprom::LayoutField<SettingsData, 1> {};
+	/// struct HighScores : eeprom::LayoutField<uint16_t[10], 2, 2> {};
+	///
+	/// using SaveLayout = eeprom::Layout<16, Settings, HighScores>;
+	///
+	/// if(!SaveLayout::valid())
+	/// {
+	/// 	SaveLayout::get<Settings>() = SettingsData();
+	/// 	SaveLayout::stamp();
+	/// }
+	///
+	/// auto scores = SaveLayout::get<HighScores>();
+	/// ```
+	///
+	/// @tparam base
+	/// The offset in eeprom at which the layout starts.
+	///
+	/// @tparam Fields
+	/// The fields of the layout, each a distinct type derived from @ref LayoutField,
+	/// with a distinct identifier.
+	template<size_t base, typename ... Fields>
+	class Layout
+	{
+		static_assert(details::layout_distinct<Fields...>::value, "Layout fields must be distinct types with distinct identifiers");
+
+	private:
+		using builder = details::layout_builder<(base + sizeof(uint32_t)), Fields...>;
+
+	public:
+		/// @brief
+		/// The offset at which the layout starts, which is where the hash is stored.
+		static constexpr size_t begin = base;
+
+		/// @brief
+		/// The offset just beyond the last field.
+		static constexpr size_t end = builder::end;
+
+		/// @brief
+		/// The number of bytes occupied by the layout, including the hash.
+		static constexpr size_t size = (end - begin);
+
+		/// @brief
+		/// The hash of the layout.
+		static constexpr uint32_t hash = builder::hash(utils::details::fnv1a_offset_basis);
+
+		static_assert(end <= (E2END + 1), "Layout does not fit within eeprom");
+
+		/// @brief
+		/// The type of the handle for field `Field`.
+		template<typename Field>
+		using handle_type = typename details::layout_handle<typename Field::value_type>::type;
+
+		/// @brief
+		/// Returns the offset in eeprom of field `Field`.
+		template<typename Field>
+		static constexpr size_t offset()
+		{
+			return details::layout_find<Field, (base + sizeof(uint32_t)), Fields...>::offset;
+		}
+
+		/// @brief
+		/// Returns an @ref EepromReference or @ref EepromArray that refers to field `Field`.
+		template<typename Field>
+		static handle_type<Field> get()
+		{
+			return details::layout_handle<typename Field::value_type>::make(offset<Field>());
+		}
+
+		/// @brief
+		/// Returns `true` if the hash stored in eeprom matches this layout,
+		/// otherwise returns `false`.
+		static bool valid()
+		{
+			return (eeprom::readEeprom(stored_hash()) == hash);
+		}
+
+		/// @brief
+		/// Stores the hash of this layout in eeprom,
+		/// marking the stored data as having this layout.
+		static void stamp()
+		{
+			eeprom::writeEeprom(stored_hash(), hash);
+		}
+
+	private:
+		static uint32_t & stored_hash()
+		{
+			return *reinterpret_cast<uint32_t *>(static_cast<uintptr_t>(base));
+		}
+	};
+
+	// Definitions of the static data members, as required by C++11
+
+	template<typename Type, uint16_t identifier_value, size_t alignment_value>
+	constexpr uint16_t LayoutField<Type, identifier_value, alignment_value>::identifier;
+
+	template<typename Type, uint16_t identifier_value, size_t alignment_value>
+	constexpr size_t LayoutField<Type, identifier_value, alignment_value>::size;
+
+	template<typename Type, uint16_t identifier_value, size_t alignment_value>
+	constexpr size_t LayoutField<Type, identifier_value, alignment_value>::alignment;
+
+	template<size_t base, typename ... Fields>
+	constexpr size_t Layout<base, Fields...>::begin;
+
+	template<size_t base, typename ... Fields>
+	constexpr size_t Layout<base, Fields...>::end;
+
+	template<size_t base, typename ... Fields>
+	constexpr size_t Layout<base, Fields...>::size;
+
+	template<size_t base, typename ... Fields>
+	constexpr uint32_t Layout<base, Fields...>::hash;
+}
\ No newline at end of file
@@ -0,0 +1,272 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+#include "readEeprom.h"
+#include "updateEeprom.h"
+#include "EepromReference.h"
+#include "SchemaMigrator.h"
+#include "details/schema_details.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// Describes one version of the data stored by a @ref SchemaChain.
+	///
+	/// @tparam version_value
+	/// The version number, which must be greater than that of the previous schema.
+	/// The version `0xFF` is reserved for erased eeprom.
+	///
+	/// @tparam Type
+	/// The type of the data stored in this version.
+	///
+	/// @tparam Migration
+	/// A type with a static `migrate(SchemaMigrator &)` function
+	/// that upgrades the data of the previous schema to this one.
+	/// Unused for the first schema of a chain.
+	/// To upgrade with a writer other than the default,
+	/// `migrate` must instead be a function template that accepts any @ref BasicSchemaMigrator.
+	template<uint8_t version_value, typename Type, typename Migration = void>
+	struct Schema
+	{
+		static_assert(version_value != 0xFF, "version 0xFF is reserved for erased eeprom");
+
+		static constexpr uint8_t version = version_value;
+
+		using value_type = Type;
+		using migration_type = Migration;
+	};
+
+	// Definitions of the static data members, as required by C++11
+	template<uint8_t version_value, typename Type, typename Migration>
+	constexpr uint8_t Schema<version_value, Type, Migration>::version;
+
+	/// @brief
+	/// Stores data in eeprom along with its version,
+	/// upgrading data saved by older firmware in place rather than discarding it.
+	///
+	/// @details
+	/// Each schema after the first provides a migration function,
+	/// which upgrades the data one step at a time through a @ref SchemaMigrator,
+	/// using only a small window of RAM regardless of the size of the data.
+	///
+	/// Progress is recorded as the migration runs,
+	/// and the version is only updated once every step is complete,
+	/// so calling @ref upgrade again after power loss resumes the migration.
+	///
+	/// E.g.
+	/// ```
+	/// using SaveSchema = eeprom::SchemaChain<
+	/// 	eeprom::Schema<1, SaveV1>,
+	/// 	eeprom::Schema<2, SaveV2, MigrateToV2>>;
+	///
+	/// auto & storage = *reinterpret_cast<SaveSchema::storage_type *>(address);
+	///
+	/// if(!SaveSchema::upgrade(storage))
+	/// 	SaveSchema::initialise(storage, SaveV2());
+	///
+	/// SaveV2 save = SaveSchema::reference(storage);
+	/// ```
+	///
+	/// @tparam Schemas
+	/// The @ref Schema of every version, in ascending order of version.
+	template<typename ... Schemas>
+	class SchemaChain
+	{
+		static_assert(sizeof...(Schemas) > 0, "a schema chain must contain at least one schema");
+		static_assert(details::schema_versions_ascending<Schemas...>::value, "schema versions must be in ascending order");
+
+	public:
+		/// @brief
+		/// The latest @ref Schema.
+		using schema_type = typename details::schema_last<Schemas...>::type;
+
+		/// @brief
+		/// The type of the data stored by the latest schema.
+		using value_type = typename schema_type::value_type;
+
+		/// @brief
+		/// The unsigned integer type used for measuring sizes.
+		using size_type = size_t;
+
+		/// @brief
+		/// The latest version.
+		static constexpr uint8_t version = schema_type::version;
+
+		/// @brief
+		/// The size of the region reserved for the data,
+		/// which is large enough for every version.
+		static constexpr size_type data_size = details::schema_max_size<Schemas...>::value;
+
+		/// @brief
+		/// The layout of the chain in eeprom.
+		struct storage_type
+		{
+			uint8_t version;
+			SchemaMigrator::journal_type::storage_type journal;
+			uint8_t data[data_size];
+		};
+
+	public:
+		/// @brief
+		/// Returns the version of the data currently stored.
+		static uint8_t storedVersion(const storage_type & storage)
+		{
+			return eeprom::readEeprom(storage.version);
+		}
+
+		/// @brief
+		/// Returns `true` if the stored data is of the latest version,
+		/// otherwise returns `false`.
+		static bool current(const storage_type & storage)
+		{
+			return (storedVersion(storage) == version);
+		}
+
+		/// @brief
+		/// Upgrades the stored data to the latest version,
+		/// resuming any migration that was interrupted.
+		///
+		/// @return
+		/// `true` if the stored data is now of the latest version,
+		/// or `false` if the stored version is not part of the chain,
+		/// such as when the eeprom has never been written.
+		///
+		/// @tparam Writer
+		/// The type used to write to eeprom. See @ref EepromWriter.
+		template<typename Writer = EepromUpdater>
+		static bool upgrade(storage_type & storage)
+		{
+			return migrate_from<Writer, Schemas...>(storage, storedVersion(storage));
+		}
+
+		/// @brief
+		/// Writes `value` as the data of the latest version,
+		/// discarding whatever was stored before.
+		///
+		/// @details
+		/// The version is written last,
+		/// so the data is only recognised once it is complete.
+		///
+		/// @tparam Writer
+		/// The type used to write to eeprom. See @ref EepromWriter.
+		template<typename Writer = EepromUpdater>
+		static void initialise(storage_type & storage, const value_type & value)
+		{
+			write_version<Writer>(storage, 0xFF);
+			clear_journal<Writer>(storage);
+			Writer::write(&data(storage), &value, sizeof(value_type));
+			write_version<Writer>(storage, version);
+		}
+
+		/// @brief
+		/// Returns the data of the latest version.
+		///
+		/// @warning
+		/// There is no way of verifying that the data has been upgraded.
+		/// Accessing data that is not @ref current results in
+		/// <strong>undefined behaviour</strong>.
+		static value_type & data(storage_type & storage)
+		{
+			return *reinterpret_cast<value_type *>(&storage.data[0]);
+		}
+
+		/// @brief
+		/// Returns the data of the latest version.
+		///
+		/// @warning
+		/// There is no way of verifying that the data has been upgraded.
+		/// Accessing data that is not @ref current results in
+		/// <strong>undefined behaviour</strong>.
+		static const value_type & data(const storage_type & storage)
+		{
+			return *reinterpret_cast<const value_type *>(&storage.data[0]);
+		}
+
+		/// @brief
+		/// Returns an @ref EepromReference to the data of the latest version.
+		///
+		/// @warning
+		/// There is no way of verifying that the data has been upgraded.
+		/// Accessing data that is not @ref current results in
+		/// <strong>undefined behaviour</strong>.
+		static EepromReference<value_type> reference(storage_type & storage)
+		{
+			return EepromReference<value_type>(data(storage));
+		}
+
+	private:
+		// Finds the stored version, then runs every later migration
+		template<typename Writer, typename Schema>
+		static bool migrate_from(storage_type &, uint8_t stored)
+		{
+			return (stored == Schema::version);
+		}
+
+		template<typename Writer, typename Schema, typename Next, typename ... Rest>
+		static bool migrate_from(storage_type & storage, uint8_t stored)
+		{
+			if(stored == Schema::version)
+			{
+				run_migrations<Writer, Next, Rest...>(storage, stored);
+				return true;
+			}
+
+			return migrate_from<Writer, Next, Rest...>(storage, stored);
+		}
+
+		template<typename Writer, typename Schema>
+		static void run_migrations(storage_type & storage, uint8_t from)
+		{
+			run_migration<Writer, Schema>(storage, from);
+		}
+
+		template<typename Writer, typename Schema, typename Next, typename ... Rest>
+		static void run_migrations(storage_type & storage, uint8_t from)
+		{
+			run_migration<Writer, Schema>(storage, from);
+			run_migrations<Writer, Next, Rest...>(storage, Schema::version);
+		}
+
+		template<typename Writer, typename Schema>
+		static void run_migration(storage_type & storage, uint8_t from)
+		{
+			{
+				typename BasicSchemaMigrator<Writer>::journal_type journal(storage.journal);
+				BasicSchemaMigrator<Writer> migrator(&storage.data[0], journal, from);
+
+				Schema::migration_type::migrate(migrator);
+			}
+
+			// A single byte, so the new version is recorded atomically
+			write_version<Writer>(storage, Schema::version);
+
+			clear_journal<Writer>(storage);
+		}
+
+		template<typename Writer>
+		static void write_version(storage_type & storage, uint8_t value)
+		{
+			Writer::write(&storage.version, &value, sizeof(value));
+		}
+
+		// Prevents stale progress from being applied if the same version is ever migrated again
+		template<typename Writer>
+		static void clear_journal(storage_type & storage)
+		{
+			typename BasicSchemaMigrator<Writer>::journal_type journal(storage.journal);
+			journal = details::schema_progress { 0xFF, 0 };
+		}
+	};
+
+	// Definitions of the static data members, as required by C++11
+	template<typename ... Schemas>
+	constexpr uint8_t SchemaChain<Schemas...>::version;
+
+	template<typename ... Schemas>
+	constexpr size_t SchemaChain<Schemas...>::data_size;
+}
\ No newline at end of file
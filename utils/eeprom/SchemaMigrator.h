@@ -0,0 +1,235 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For eeprom_read_block
+#include <avr/eeprom.h>
+
+#include "readEeprom.h"
+#include "updateEeprom.h"
+#include "WearLevelled.h"
+#include "details/schema_details.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// Performs the steps of a single migration of a @ref SchemaChain,
+	/// recording its progress so that it can resume after power loss.
+	///
+	/// @details
+	/// A migration function describes how to upgrade the data in place
+	/// as a sequence of steps, each of which is a call to
+	/// @ref move, @ref fill or @ref set.
+	///
+	/// Steps are numbered by the bytes they write,
+	/// and progress is saved after every chunk of at most 8 bytes.
+	/// If power is lost, the migration function is called again from the start,
+	/// and steps that were already completed are skipped,
+	/// while the interrupted step resumes from its last saved chunk.
+	///
+	/// Steps are performed in the order they are called,
+	/// so a step must not overwrite data that a later step reads.
+	///
+	/// E.g.
+	/// ```
+	/// struct SaveV1 { uint8_t level; uint16_t score; };
+	/// struct SaveV2 { uint8_t level; uint8_t lives; uint16_t score; };
+	///
+	/// struct MigrateToV2
+	/// {
+	/// 	static void migrate(eeprom::SchemaMigrator & migrator)
+	/// 	{
+	/// 		// Make room for the new field before filling it in
+	/// 		migrator.move(offsetof(SaveV1, score), offsetof(SaveV2, score), sizeof(uint16_t));
+	/// 		migrator.fill(offsetof(SaveV2, lives), 1, 3);
+	/// 	}
+	/// };
+	/// ```
+	///
+	/// @tparam Writer
+	/// The type used to write to eeprom. See @ref EepromWriter.
+	/// The data and the progress are both written through it.
+	template<typename Writer>
+	class BasicSchemaMigrator
+	{
+	public:
+		/// @brief
+		/// The unsigned integer type used for measuring sizes and offsets.
+		using size_type = size_t;
+
+		/// @brief
+		/// The type used to record progress in eeprom.
+		using journal_type = WearLevelled<details::schema_progress, 2, Writer>;
+
+	private:
+		uint8_t * data;
+		journal_type * journal;
+		uint8_t version;
+		uint16_t saved_position;
+		uint16_t position;
+
+	public:
+		/// @brief
+		/// Constructs a @ref BasicSchemaMigrator for the migration from `version`,
+		/// resuming from the progress recorded in `journal`.
+		///
+		/// @details
+		/// Used by @ref SchemaChain, rather than directly.
+		BasicSchemaMigrator(uint8_t * data, journal_type & journal, uint8_t version) :
+			data(data), journal(&journal), version(version), saved_position(0), position(0)
+		{
+			const details::schema_progress progress = journal;
+
+			if(progress.version == version)
+				this->saved_position = progress.position;
+		}
+
+		/// @brief
+		/// Reads an object at `offset` within the data.
+		///
+		/// @warning
+		/// If the read is used to compute the value of a later step,
+		/// that step's destination must not overlap the bytes read,
+		/// otherwise a resumed migration may read partially overwritten data.
+		template<typename Type>
+		Type read(size_type offset) const
+		{
+			return eeprom::readEeprom(*reinterpret_cast<const Type *>(&this->data[offset]));
+		}
+
+		/// @brief
+		/// Moves `size` bytes from offset `from` to offset `to` within the data.
+		///
+		/// @details
+		/// The source and destination may overlap.
+		/// Bytes are moved in chunks no larger than the distance moved,
+		/// so that a chunk never overwrites its own source,
+		/// which allows an interrupted move to be resumed.
+		void move(size_type from, size_type to, size_type size)
+		{
+			size_type done = 0;
+
+			if(!this->begin_step(size, done))
+				return;
+
+			if(from == to)
+			{
+				this->end_step(size);
+				return;
+			}
+
+			const size_type distance = (from < to) ? (to - from) : (from - to);
+			const size_type chunk_limit = (distance < details::schema_window_size) ? distance : details::schema_window_size;
+
+			uint8_t window[details::schema_window_size];
+
+			while(done < size)
+			{
+				const size_type remaining = (size - done);
+				const size_type count = (remaining < chunk_limit) ? remaining : chunk_limit;
+
+				// Moving towards the end copies from the end backwards, as with memmove
+				const size_type offset = (from < to) ? (size - done - count) : done;
+
+				eeprom_read_block(&window[0], &this->data[from + offset], count);
+				Writer::write(&this->data[to + offset], &window[0], count);
+
+				done += count;
+				this->save(done);
+			}
+
+			this->end_step(size);
+		}
+
+		/// @brief
+		/// Sets `size` bytes at `offset` within the data to `value`.
+		void fill(size_type offset, size_type size, uint8_t value)
+		{
+			size_type done = 0;
+
+			if(!this->begin_step(size, done))
+				return;
+
+			uint8_t window[details::schema_window_size];
+
+			for(size_type index = 0; index < details::schema_window_size; ++index)
+				window[index] = value;
+
+			while(done < size)
+			{
+				const size_type remaining = (size - done);
+				const size_type count = (remaining < details::schema_window_size) ? remaining : details::schema_window_size;
+
+				Writer::write(&this->data[offset + done], &window[0], count);
+
+				done += count;
+				this->save(done);
+			}
+
+			this->end_step(size);
+		}
+
+		/// @brief
+		/// Writes `value` at `offset` within the data.
+		///
+		/// @details
+		/// If the migration is resumed after this step has completed,
+		/// the step is skipped, so `value` may be computed from data
+		/// that has since been overwritten.
+		template<typename Type>
+		void set(size_type offset, const Type & value)
+		{
+			size_type done = 0;
+
+			if(!this->begin_step(sizeof(Type), done))
+				return;
+
+			Writer::write(&this->data[offset], &value, sizeof(Type));
+
+			this->end_step(sizeof(Type));
+		}
+
+	private:
+		// Returns false if the step was already completed,
+		// otherwise sets 'done' to the number of bytes already written
+		bool begin_step(size_type size, size_type & done)
+		{
+			const size_type end = (this->position + size);
+
+			if(this->saved_position >= end)
+			{
+				this->position = static_cast<uint16_t>(end);
+				return false;
+			}
+
+			done = (this->saved_position > this->position) ? (this->saved_position - this->position) : 0;
+			return true;
+		}
+
+		void end_step(size_type size)
+		{
+			this->position = static_cast<uint16_t>(this->position + size);
+			this->save(0);
+		}
+
+		void save(size_type done)
+		{
+			const uint16_t position = static_cast<uint16_t>(this->position + done);
+
+			if(position <= this->saved_position)
+				return;
+
+			*this->journal = details::schema_progress { this->version, position };
+			this->saved_position = position;
+		}
+	};
+
+	/// @brief
+	/// The @ref BasicSchemaMigrator used by migration functions,
+	/// which changes only the bytes that differ, as @ref updateEeprom does.
+	using SchemaMigrator = BasicSchemaMigrator<EepromUpdater>;
+}
\ No newline at end of file
@@ -0,0 +1,197 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint16_t, int16_t
+#include <stdint.h>
+
+// For eeprom_read_block
+#include <avr/eeprom.h>
+
+#include "readEeprom.h"
+#include "EepromWriter.h"
+#include "details/crc_details.h"
+#include "details/transactional_details.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// Stores an object in eeprom so that it is never left corrupted,
+	/// even if power is lost while it is being written.
+	///
+	/// @details
+	/// The object is stored in two slots, each with a generation counter
+	/// and a CRC-16 covering both the counter and the object.
+	///
+	/// @ref commit writes the slot that isn't in use,
+	/// writing the object, then the CRC, and the generation counter last.
+	/// Until the write is complete, the CRC of that slot does not match,
+	/// so @ref load continues to choose the other slot.
+	///
+	/// @ref load chooses the valid slot with the newest generation.
+	///
+	/// E.g.
+	/// ```
+	/// using SaveData = eeprom::Transactional<Save>;
+	///
+	/// SaveData saveData(*reinterpret_cast<SaveData::storage_type *>(address));
+	///
+	/// Save save;
+	///
+	/// if(!saveData.load(save))
+	/// 	save = Save();
+	///
+	/// saveData.commit(save);
+	/// ```
+	///
+	/// @note
+	/// The object type must be trivially copyable.
+	///
+	/// @tparam Writer
+	/// The type used to write to eeprom. See @ref EepromWriter.
+	template<typename Type, typename Writer = EepromWriter>
+	class Transactional
+	{
+	public:
+		/// @brief
+		/// The type of the object stored.
+		using value_type = Type;
+
+		/// @brief
+		/// The unsigned integer type used for measuring sizes.
+		/// Also used to represent slot indices.
+		using size_type = size_t;
+
+		/// @brief
+		/// The layout of a single slot in eeprom.
+		/// Identical for every @p Writer.
+		using slot_type = details::transactional_slot<value_type>;
+
+		/// @brief
+		/// The layout of both slots in eeprom.
+		using storage_type = slot_type[2];
+
+	private:
+		slot_type * slots;
+		uint16_t current_generation;
+		uint8_t current_slot;
+		bool has_value;
+
+	public:
+		/// @brief
+		/// Constructs a @ref Transactional that uses the provided slots,
+		/// and finds the slot holding the newest valid object.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided reference refers to eeprom.
+		/// It is thus possible to construct an invalid @ref Transactional,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		explicit Transactional(storage_type & storage) :
+			slots(&storage[0]), current_generation(0), current_slot(1), has_value(false)
+		{
+			this->find_newest();
+		}
+
+		/// @brief
+		/// Returns `true` if either slot holds a valid object,
+		/// otherwise returns `false`.
+		bool valid() const
+		{
+			return this->has_value;
+		}
+
+		/// @brief
+		/// Returns the generation of the newest valid object.
+		uint16_t generation() const
+		{
+			return this->current_generation;
+		}
+
+		/// @brief
+		/// Returns the index of the slot holding the newest valid object.
+		size_type slot() const
+		{
+			return this->current_slot;
+		}
+
+		/// @brief
+		/// Reads the newest valid object into `value`.
+		///
+		/// @details
+		/// Each slot's CRC is computed directly from eeprom,
+		/// so the only copy of the object in RAM is `value`.
+		///
+		/// @return
+		/// `true` if a valid object was found,
+		/// or `false` if neither slot is valid, in which case `value` is unchanged.
+		bool load(value_type & value)
+		{
+			if(!this->find_newest())
+				return false;
+
+			eeprom_read_block(&value, &this->slots[this->current_slot].value, sizeof(value_type));
+			return true;
+		}
+
+		/// @brief
+		/// Writes `value` to the slot that isn't in use,
+		/// making it the newest valid object once the write is complete.
+		void commit(const value_type & value)
+		{
+			const uint8_t next_slot = (this->current_slot == 0) ? 1 : 0;
+
+			const uint16_t generation = static_cast<uint16_t>(this->current_generation + 1);
+			const uint16_t crc = details::crc16(&value, sizeof(value_type), details::crc16(&generation, sizeof(generation)));
+
+			slot_type & destination = this->slots[next_slot];
+
+			// The generation is written last, so the CRC can't match until the slot is complete
+			Writer::write(&destination.value, &value, sizeof(value_type));
+			Writer::write(&destination.crc, &crc, sizeof(crc));
+			Writer::write(&destination.generation, &generation, sizeof(generation));
+
+			this->has_value = true;
+			this->current_generation = generation;
+			this->current_slot = next_slot;
+		}
+
+	private:
+		// Chooses the valid slot with the newest generation, without reading either object into RAM
+		bool find_newest()
+		{
+			uint16_t first;
+			uint16_t second;
+
+			const bool first_valid = check_slot(this->slots[0], first);
+			const bool second_valid = check_slot(this->slots[1], second);
+
+			if(!first_valid && !second_valid)
+			{
+				this->has_value = false;
+				this->current_generation = 0;
+				this->current_slot = 1;
+				return false;
+			}
+
+			// Generations wrap around, so compare them by their difference
+			const bool use_second = second_valid && (!first_valid || (static_cast<int16_t>(second - first) > 0));
+
+			this->has_value = true;
+			this->current_generation = use_second ? second : first;
+			this->current_slot = use_second ? 1 : 0;
+
+			return true;
+		}
+
+		// Streams the slot through the CRC, reading only its generation into RAM
+		static bool check_slot(const slot_type & slot, uint16_t & generation)
+		{
+			generation = eeprom::readEeprom(slot.generation);
+
+			const uint16_t crc = details::crc16_eeprom(&slot.value, sizeof(value_type), details::crc16(&generation, sizeof(generation)));
+
+			return (crc == eeprom::readEeprom(slot.crc));
+		}
+	};
+}
\ No newline at end of file
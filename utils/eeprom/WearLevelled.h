@@ -0,0 +1,194 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint32_t
+#include <stdint.h>
+
+// For memcmp
+#include <string.h>
+
+#include "readEeprom.h"
+#include "EepromWriter.h"
+#include "details/wear_levelled_details.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// Stores a frequently updated object in eeprom,
+	/// rotating writes through a ring of slots to spread wear across them.
+	///
+	/// @details
+	/// Each slot holds a copy of the object and a sequence number.
+	/// Every write goes to the slot after the latest one,
+	/// with a sequence number one greater than the latest one's.
+	/// The latest slot is thus the last before the sequence is broken,
+	/// and is found with a single scan of the sequence numbers on construction.
+	///
+	/// The object is written before its sequence number,
+	/// so if power is lost part way through a write,
+	/// the previous value is still the one that is found.
+	///
+	/// Each slot is written once every `slot_count` writes,
+	/// so the ring lasts `slot_count` times longer than a single object.
+	///
+	/// A ring that has never been written to reads as the contents of its first slot.
+	///
+	/// E.g.
+	/// ```
+	/// using PlayTime = eeprom::WearLevelled<uint32_t, 16>;
+	///
+	/// PlayTime playTime(*reinterpret_cast<PlayTime::storage_type *>(address));
+	///
+	/// playTime = playTime + 5;
+	/// ```
+	///
+	/// @tparam slot_count
+	/// The number of slots in the ring.
+	/// Must be at least 2 and less than 256.
+	///
+	/// @tparam Writer
+	/// The type used to write to eeprom. See @ref EepromWriter.
+	template<typename Type, size_t slot_count, typename Writer = EepromWriter>
+	class WearLevelled
+	{
+		static_assert(slot_count >= 2, "WearLevelled requires at least 2 slots");
+		static_assert(slot_count < 256, "WearLevelled requires fewer than 256 slots");
+
+	public:
+		/// @brief
+		/// The type of the object stored in the ring.
+		using value_type = Type;
+
+		/// @brief
+		/// The unsigned integer type used for measuring sizes.
+		/// Also used to represent slot indices.
+		using size_type = size_t;
+
+		/// @brief
+		/// The layout of a single slot in eeprom.
+		/// Identical for every @p Writer.
+		using slot_type = details::wear_levelled_slot<value_type>;
+
+		/// @brief
+		/// The layout of the whole ring in eeprom.
+		using storage_type = slot_type[slot_count];
+
+		/// @brief
+		/// The number of times each eeprom cell can be written,
+		/// as given by the AVR datasheets.
+		static constexpr uint32_t endurance = 100000;
+
+	private:
+		slot_type * slots;
+		uint8_t latest_slot;
+		uint8_t latest_sequence;
+
+	public:
+		/// @brief
+		/// Constructs a @ref WearLevelled that uses the provided ring of slots,
+		/// and finds the latest slot.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided reference refers to eeprom.
+		/// It is thus possible to construct an invalid @ref WearLevelled,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		explicit WearLevelled(storage_type & storage) :
+			slots(&storage[0]), latest_slot(0), latest_sequence(0)
+		{
+			this->scan();
+		}
+
+		/// @brief
+		/// Finds the latest slot by reading the sequence number of each slot.
+		///
+		/// @details
+		/// This is done on construction, so only needs to be called
+		/// if the ring is written by something else.
+		void scan()
+		{
+			uint8_t previous = eeprom::readEeprom(this->slots[0].sequence);
+
+			for(size_type index = 1; index < slot_count; ++index)
+			{
+				const uint8_t sequence = eeprom::readEeprom(this->slots[index].sequence);
+
+				if(sequence != static_cast<uint8_t>(previous + 1))
+				{
+					this->latest_slot = static_cast<uint8_t>(index - 1);
+					this->latest_sequence = previous;
+					return;
+				}
+
+				previous = sequence;
+			}
+
+			this->latest_slot = static_cast<uint8_t>(slot_count - 1);
+			this->latest_sequence = previous;
+		}
+
+		/// @brief
+		/// Returns the index of the slot holding the latest value.
+		size_type slot() const
+		{
+			return this->latest_slot;
+		}
+
+		/// @brief
+		/// Writes a new value to the next slot in the ring.
+		///
+		/// @details
+		/// If the new value is identical to the latest value, nothing is written.
+		WearLevelled & operator =(const value_type & value)
+		{
+			const value_type current = *this;
+
+			if(memcmp(&current, &value, sizeof(value_type)) == 0)
+				return *this;
+
+			const uint8_t next_slot = (static_cast<size_type>(this->latest_slot + 1) < slot_count) ? static_cast<uint8_t>(this->latest_slot + 1) : 0;
+			const uint8_t next_sequence = static_cast<uint8_t>(this->latest_sequence + 1);
+
+			// The value must be complete before the sequence number marks it as the latest
+			Writer::write(&this->slots[next_slot].value, &value, sizeof(value_type));
+			Writer::write(&this->slots[next_slot].sequence, &next_sequence, sizeof(next_sequence));
+
+			this->latest_slot = next_slot;
+			this->latest_sequence = next_sequence;
+
+			return *this;
+		}
+
+		/// @brief
+		/// Reads the latest value.
+		operator value_type() const
+		{
+			return eeprom::readEeprom(this->slots[this->latest_slot].value);
+		}
+
+		/// @brief
+		/// Returns the number of writes the ring is projected to survive.
+		static constexpr uint32_t lifetime_writes()
+		{
+			return (endurance * slot_count);
+		}
+
+		/// @brief
+		/// Returns the number of days the ring is projected to survive,
+		/// if it is written to `writes_per_day` times each day.
+		///
+		/// @details
+		/// E.g. a value written every 5 seconds during 2 hours of play each day
+		/// is written 1440 times per day.
+		static constexpr uint32_t lifetime_days(uint32_t writes_per_day)
+		{
+			return (lifetime_writes() / writes_per_day);
+		}
+	};
+
+	// Definitions of the static data members, as required by C++11
+
+	template<typename Type, size_t slot_count, typename Writer>
+	constexpr uint32_t WearLevelled<Type, slot_count, Writer>::endurance;
+}
\ No newline at end of file
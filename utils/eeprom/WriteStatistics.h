@@ -0,0 +1,39 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+namespace eeprom
+{
+	/// @brief
+	/// Reports the work done by @ref updateEeprom,
+	/// so that eeprom wear can be logged.
+	struct WriteStatistics
+	{
+		/// @brief
+		/// The number of bytes compared against their new value.
+		size_t compared;
+
+		/// @brief
+		/// The number of bytes that were changed.
+		size_t written;
+
+		/// @brief
+		/// The number of changed bytes that had to be erased.
+		///
+		/// @details
+		/// A byte whose bits only need to be cleared is written without being erased,
+		/// and a byte being set to `0xFF` is erased without being written.
+		size_t erased;
+
+		/// @brief
+		/// Adds the statistics of another update to these.
+		WriteStatistics & operator +=(const WriteStatistics & other)
+		{
+			this->compared += other.compared;
+			this->written += other.written;
+			this->erased += other.erased;
+			return *this;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+// For ISR
+#include <avr/interrupt.h>
+
+#include "details/async_write_details.h"
+
+/// @brief
+/// Defines the eeprom ready interrupt handler that feeds queued writes to eeprom.
+///
+/// @details
+/// Must be used exactly once, at namespace scope, in any program that uses
+/// @ref eeprom::asyncWrite.
+/// Queuing a write enables the eeprom ready interrupt,
+/// and an enabled interrupt without a handler resets the board,
+/// so a program that uses @ref eeprom::asyncWrite without this macro fails to link.
+///
+/// E.g.
+/// ```
+/// #include <eeprom.h>
+///
+/// EEPROM_ASYNC_WRITE_INTERRUPT
+/// ```
+#define EEPROM_ASYNC_WRITE_INTERRUPT \
+	void ::eeprom::details::enable_async_write_interrupt() \
+	{ \
+		EECR |= _BV(EERIE); \
+	} \
+	\
+	ISR(EE_READY_vect) \
+	{ \
+		::eeprom::details::service_async_write(); \
+	}
+
+namespace eeprom
+{
+	/// @brief
+	/// Queues `size` bytes from `source` to be written to eeprom at `destination`,
+	/// and returns without waiting for them to be written.
+	///
+	/// @details
+	/// The bytes are written one at a time by the eeprom ready interrupt,
+	/// defined by @ref EEPROM_ASYNC_WRITE_INTERRUPT.
+	/// Bytes that already have the queued value are not rewritten.
+	///
+	/// If the queue is full, this function waits until there is space,
+	/// so at most `EEPROM_ASYNC_WRITE_QUEUE_SIZE` bytes can be written without blocking.
+	///
+	/// @warning
+	/// Synchronous eeprom functions such as @ref readEeprom and @ref writeEeprom
+	/// must not be used while writes are queued.
+	/// Use @ref asyncRead instead, or call @ref asyncFlush first.
+	///
+	/// @warning
+	/// There is no way to verify that the provided pointer points to eeprom.
+	/// Calling this function with a pointer that does not point to eeprom
+	/// will result in <strong>undefined behaviour</strong>.
+	inline void asyncWrite(void * destination, const void * source, size_t size)
+	{
+		uint8_t * destinationBytes = static_cast<uint8_t *>(destination);
+		const uint8_t * sourceBytes = static_cast<const uint8_t *>(source);
+
+		for(size_t index = 0; index < size; ++index)
+			details::queue_async_write(&destinationBytes[index], sourceBytes[index]);
+	}
+
+	/// @brief
+	/// Queues an object to be written to eeprom,
+	/// and returns without waiting for it to be written.
+	///
+	/// @details
+	/// Behaves the same as @ref asyncWrite(void *, const void *, size_t).
+	///
+	/// @note
+	/// The object type must be trivially copyable.
+	///
+	/// @warning
+	/// There is no way to verify that the provided reference refers to an object in eeprom.
+	/// Calling this function on an object that is not stored in eeprom
+	/// will result in <strong>undefined behaviour</strong>.
+	template<typename Type>
+	void asyncWrite(Type & destination, const Type & source)
+	{
+		asyncWrite(&destination, &source, sizeof(Type));
+	}
+
+	/// @brief
+	/// Reads an object from eeprom, including the effect of any writes
+	/// that are queued but have not yet been made.
+	///
+	/// @details
+	/// Interrupts are disabled while reading,
+	/// which includes waiting for any write already in progress to complete.
+	///
+	/// @note
+	/// The object type must be trivially copyable.
+	///
+	/// @warning
+	/// There is no way to verify that the provided reference refers to an object in eeprom.
+	/// Calling this function on an object that is not stored in eeprom
+	/// will result in <strong>undefined behaviour</strong>.
+	template<typename Type>
+	Type asyncRead(const Type & object)
+	{
+		Type result;
+		details::read_async(reinterpret_cast<uint8_t *>(&result), reinterpret_cast<const uint8_t *>(&object), sizeof(Type));
+		return result;
+	}
+
+	/// @brief
+	/// Returns the number of queued bytes that have yet to be written.
+	inline size_t asyncPending()
+	{
+		details::interrupt_lock lock;
+
+		return details::async_write_state<>::queue.size();
+	}
+
+	/// @brief
+	/// Returns `true` if every queued byte has been written,
+	/// otherwise returns `false`.
+	inline bool asyncComplete()
+	{
+		details::interrupt_lock lock;
+
+		return (details::async_write_state<>::queue.empty() && !details::eeprom_write_in_progress());
+	}
+
+	/// @brief
+	/// Waits until every queued byte has been written.
+	///
+	/// @details
+	/// The queue is serviced directly while waiting,
+	/// so this function also works while interrupts are disabled.
+	inline void asyncFlush()
+	{
+		while(!asyncComplete())
+			details::poll_async_write();
+
+		details::finish_async_write();
+	}
+
+	/// @brief
+	/// Sets a function to be called once every queued byte has been written.
+	///
+	/// @details
+	/// The function is called from the eeprom ready interrupt,
+	/// so it should be short and must not queue further writes.
+	/// Pass `nullptr` to remove the callback.
+	inline void setAsyncWriteCallback(void (* callback)())
+	{
+		details::interrupt_lock lock;
+
+		details::async_write_state<>::callback = callback;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For eeprom_read_block, eeprom_update_block
+#include <avr/eeprom.h>
+
+#include "../utils/copy.h"
+#include "EepromPointer.h"
+#include "specialisations/EepromPointer_const.h"
+
+namespace utils
+{
+	/// @brief
+	/// Copies a range of objects from eeprom into RAM.
+	///
+	/// @details
+	/// Reads the objects as a single block using `eeprom_read_block`,
+	/// rather than reading one object at a time through @ref eeprom::EepromReference.
+	///
+	/// @return
+	/// A pointer beyond the last object copied.
+	template<typename Type>
+	Type * copy(eeprom::EepromPointer<const Type> first, eeprom::EepromPointer<const Type> last, Type * output)
+	{
+		const size_t count = static_cast<size_t>(last - first);
+
+		eeprom_read_block(output, static_cast<const Type *>(first), count * sizeof(Type));
+
+		return (output + count);
+	}
+
+	/// @brief
+	/// Copies a range of objects from eeprom into RAM.
+	///
+	/// @details
+	/// Reads the objects as a single block using `eeprom_read_block`,
+	/// rather than reading one object at a time through @ref eeprom::EepromReference.
+	///
+	/// @return
+	/// A pointer beyond the last object copied.
+	template<typename Type>
+	Type * copy(eeprom::EepromPointer<Type> first, eeprom::EepromPointer<Type> last, Type * output)
+	{
+		return utils::copy(eeprom::EepromPointer<const Type>(first), eeprom::EepromPointer<const Type>(last), output);
+	}
+
+	/// @brief
+	/// Copies a range of objects from RAM into eeprom,
+	/// avoiding writing bytes that are already identical.
+	///
+	/// @details
+	/// Writes the objects as a single block using `eeprom_update_block`,
+	/// rather than writing one object at a time through @ref eeprom::EepromReference.
+	///
+	/// @return
+	/// An @ref eeprom::EepromPointer beyond the last object copied.
+	template<typename Type>
+	eeprom::EepromPointer<Type> copy(const Type * first, const Type * last, eeprom::EepromPointer<Type> output)
+	{
+		const size_t count = static_cast<size_t>(last - first);
+
+		Type * destination = static_cast<Type *>(output);
+
+		eeprom_update_block(first, destination, count * sizeof(Type));
+
+		return eeprom::EepromPointer<Type>(destination + count);
+	}
+
+	/// @brief
+	/// Copies a range of objects from RAM into eeprom,
+	/// avoiding writing bytes that are already identical.
+	///
+	/// @details
+	/// Writes the objects as a single block using `eeprom_update_block`,
+	/// rather than writing one object at a time through @ref eeprom::EepromReference.
+	///
+	/// @return
+	/// An @ref eeprom::EepromPointer beyond the last object copied.
+	template<typename Type>
+	eeprom::EepromPointer<Type> copy(Type * first, Type * last, eeprom::EepromPointer<Type> output)
+	{
+		return utils::copy(static_cast<const Type *>(first), static_cast<const Type *>(last), output);
+	}
+}
\ No newline at end of file
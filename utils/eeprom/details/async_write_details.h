@@ -0,0 +1,158 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+// For EECR, EEAR, EEDR
+#include <avr/io.h>
+
+// For containers::CircularDeque
+#include "../../containers/CircularDeque.h"
+
+#include "interrupt_details.h"
+#include "program_details.h"
+
+// The number of byte writes that can be queued at once.
+// May be defined before including this header to change the size of the queue.
+#ifndef EEPROM_ASYNC_WRITE_QUEUE_SIZE
+#define EEPROM_ASYNC_WRITE_QUEUE_SIZE 32
+#endif
+
+namespace eeprom
+{
+	namespace details
+	{
+		struct async_write_entry
+		{
+			uint8_t * address;
+			uint8_t value;
+		};
+
+		using async_write_queue = containers::CircularDeque<async_write_entry, EEPROM_ASYNC_WRITE_QUEUE_SIZE>;
+
+		// A template, so that the state has exactly one definition
+		// no matter how many translation units include this header
+		template<typename Dummy = void>
+		struct async_write_state
+		{
+			static async_write_queue queue;
+			static void (* callback)();
+		};
+
+		template<typename Dummy>
+		async_write_queue async_write_state<Dummy>::queue;
+
+		template<typename Dummy>
+		void (* async_write_state<Dummy>::callback)() = nullptr;
+
+		// Must only be called with interrupts disabled,
+		// when no eeprom write is in progress.
+		//
+		// Starts the next queued write whose value differs from eeprom.
+		// Once the queue is empty, disables the interrupt and reports completion.
+		inline void service_async_write()
+		{
+			auto & queue = async_write_state<>::queue;
+
+			while(!queue.empty())
+			{
+				const async_write_entry entry = queue.front();
+				queue.pop_front();
+
+				EEAR = reinterpret_cast<uintptr_t>(entry.address);
+				EECR |= _BV(EERE);
+
+				const uint8_t old_value = EEDR;
+
+				// The same update semantics as writeEeprom
+				if(old_value == entry.value)
+					continue;
+
+				program_eeprom_byte(entry.address, entry.value, eeprom_mode_for(old_value, entry.value));
+				return;
+			}
+
+			EECR &= static_cast<uint8_t>(~_BV(EERIE));
+
+			if(async_write_state<>::callback != nullptr)
+				async_write_state<>::callback();
+		}
+
+		// Services the queue from outside the interrupt,
+		// so that progress is made even if interrupts are disabled
+		inline void poll_async_write()
+		{
+			interrupt_lock lock;
+
+			if(!eeprom_write_in_progress() && !async_write_state<>::queue.empty())
+				service_async_write();
+		}
+
+		// Completes the queue in the same way as the interrupt would,
+		// so that the callback has been called by the time a flush returns
+		inline void finish_async_write()
+		{
+			interrupt_lock lock;
+
+			if((EECR & _BV(EERIE)) != 0)
+				service_async_write();
+		}
+
+		// Defined only by EEPROM_ASYNC_WRITE_INTERRUPT,
+		// so that queuing a write without the interrupt handler fails to link
+		// instead of resetting the board when the interrupt fires
+		void enable_async_write_interrupt();
+
+		inline void queue_async_write(uint8_t * address, uint8_t value)
+		{
+			while(true)
+			{
+				{
+					interrupt_lock lock;
+
+					auto & queue = async_write_state<>::queue;
+
+					if(queue.size() < queue.max_size())
+					{
+						queue.push_back(async_write_entry { address, value });
+						enable_async_write_interrupt();
+						return;
+					}
+				}
+
+				poll_async_write();
+			}
+		}
+
+		// Copies 'size' bytes of eeprom starting at 'source' into 'destination',
+		// then applies any queued writes to those bytes, oldest first
+		inline void read_async(uint8_t * destination, const uint8_t * source, size_t size)
+		{
+			interrupt_lock lock;
+
+			while(eeprom_write_in_progress())
+			{
+			}
+
+			for(size_t index = 0; index < size; ++index)
+			{
+				EEAR = reinterpret_cast<uintptr_t>(&source[index]);
+				EECR |= _BV(EERE);
+				destination[index] = EEDR;
+			}
+
+			const auto & queue = async_write_state<>::queue;
+
+			for(size_t index = 0; index < queue.size(); ++index)
+			{
+				const async_write_entry & entry = queue[index];
+
+				if((entry.address >= source) && (entry.address < (source + size)))
+					destination[entry.address - source] = entry.value;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For eeprom_read_byte
+#include <avr/eeprom.h>
+
+// For progmem::LookupTable
+#include "../../progmem/LookupTable.h"
+
+namespace eeprom
+{
+	namespace details
+	{
+		// CRC-16/CCITT-FALSE: polynomial 0x1021, initial value 0xFFFF, most significant bit first
+		constexpr uint16_t crc16_polynomial = 0x1021;
+		constexpr uint16_t crc16_initial_value = 0xFFFF;
+
+		constexpr uint16_t crc16_shift(uint16_t crc, uint8_t bits)
+		{
+			return (bits == 0) ? crc :
+				crc16_shift(((crc & 0x8000) != 0) ?
+					static_cast<uint16_t>((crc << 1) ^ crc16_polynomial) :
+					static_cast<uint16_t>(crc << 1), bits - 1);
+		}
+
+		// Generates the CRC of a single byte, for each possible byte
+		struct crc16_generator
+		{
+			constexpr uint16_t operator()(size_t index) const
+			{
+				return crc16_shift(static_cast<uint16_t>(index << 8), 8);
+			}
+		};
+
+		// Stored in progmem, so each byte costs one table read rather than eight shifts
+		using crc16_table = progmem::LookupTable<uint16_t, 256, crc16_generator>;
+
+		inline uint16_t crc16_step(uint16_t crc, uint8_t byte)
+		{
+			return static_cast<uint16_t>((crc << 8) ^ crc16_table::get(static_cast<uint8_t>((crc >> 8) ^ byte)));
+		}
+
+		inline uint16_t crc16(const void * data, size_t size, uint16_t crc = crc16_initial_value)
+		{
+			const uint8_t * bytes = static_cast<const uint8_t *>(data);
+
+			for(size_t index = 0; index < size; ++index)
+				crc = crc16_step(crc, bytes[index]);
+
+			return crc;
+		}
+
+		// Computes the CRC of bytes in eeprom a byte at a time,
+		// so that no copy of them is needed in RAM
+		inline uint16_t crc16_eeprom(const void * data, size_t size, uint16_t crc = crc16_initial_value)
+		{
+			const uint8_t * bytes = static_cast<const uint8_t *>(data);
+
+			for(size_t index = 0; index < size; ++index)
+				crc = crc16_step(crc, eeprom_read_byte(&bytes[index]));
+
+			return crc;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+// For eeprom_read_block
+#include <avr/eeprom.h>
+
+#include "../WriteStatistics.h"
+#include "program_details.h"
+
+namespace eeprom
+{
+	namespace details
+	{
+		// The number of bytes read from eeprom at a time when comparing
+		constexpr size_t diff_chunk_size = 16;
+
+		// Changes a single byte using the cheapest programming mode
+		inline void update_eeprom_byte(uint8_t * address, uint8_t old_value, uint8_t new_value, WriteStatistics & statistics)
+		{
+			if(old_value == new_value)
+				return;
+
+			const uint8_t mode = eeprom_mode_for(old_value, new_value);
+
+			while(eeprom_write_in_progress())
+			{
+			}
+
+			program_eeprom_byte(address, new_value, mode);
+
+			++statistics.written;
+
+			if(mode != eeprom_mode_write_only)
+				++statistics.erased;
+		}
+
+		// Compares against eeprom a chunk at a time, then changes only the bytes that differ
+		inline WriteStatistics update_eeprom_diff(uint8_t * destination, const uint8_t * source, size_t size)
+		{
+			WriteStatistics statistics { size, 0, 0 };
+
+			uint8_t chunk[diff_chunk_size];
+
+			for(size_t offset = 0; offset < size; offset += diff_chunk_size)
+			{
+				const size_t count = ((size - offset) < diff_chunk_size) ? (size - offset) : diff_chunk_size;
+
+				while(eeprom_write_in_progress())
+				{
+				}
+
+				eeprom_read_block(&chunk[0], &destination[offset], count);
+
+				for(size_t index = 0; index < count; ++index)
+					update_eeprom_byte(&destination[offset + index], chunk[index], source[offset + index], statistics);
+			}
+
+			return statistics;
+		}
+
+		// Compares against a copy of eeprom held in RAM, which is kept up to date,
+		// so eeprom is never read
+		inline WriteStatistics update_eeprom_shadow(uint8_t * destination, const uint8_t * source, uint8_t * shadow, size_t size)
+		{
+			WriteStatistics statistics { size, 0, 0 };
+
+			for(size_t index = 0; index < size; ++index)
+			{
+				update_eeprom_byte(&destination[index], shadow[index], source[index], statistics);
+				shadow[index] = source[index];
+			}
+
+			return statistics;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+// For uint8_t
+#include <stdint.h>
+
+// For SREG
+#include <avr/io.h>
+
+// For cli
+#include <avr/interrupt.h>
+
+namespace eeprom
+{
+	namespace details
+	{
+		// Disables interrupts for its lifetime,
+		// restoring the previous interrupt state afterwards
+		class interrupt_lock
+		{
+		private:
+			uint8_t status;
+
+		public:
+			interrupt_lock() :
+				status(SREG)
+			{
+				cli();
+			}
+
+			~interrupt_lock()
+			{
+				SREG = this->status;
+			}
+
+			interrupt_lock(const interrupt_lock &) = delete;
+			interrupt_lock & operator =(const interrupt_lock &) = delete;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint32_t, uintptr_t
+#include <stdint.h>
+
+// For utils::details::fnv1a_offset_basis, utils::details::fnv1a_step
+#include "../../utils/hash.h"
+
+#include "../EepromReference.h"
+#include "../EepromArray.h"
+
+namespace eeprom
+{
+	namespace details
+	{
+		constexpr size_t align_offset(size_t offset, size_t alignment)
+		{
+			return (((offset + alignment - 1) / alignment) * alignment);
+		}
+
+		// Hashes the two low bytes of 'value'
+		constexpr uint32_t hash_layout_value(uint32_t hash, size_t value)
+		{
+			return utils::details::fnv1a_step(utils::details::fnv1a_step(hash, static_cast<char>(value & 0xFF)), static_cast<char>((value >> 8) & 0xFF));
+		}
+
+		// Assigns each field an offset after the previous field,
+		// rounded up to the field's alignment
+		template<size_t start, typename ... Fields>
+		struct layout_builder;
+
+		template<size_t start>
+		struct layout_builder<start>
+		{
+			static constexpr size_t end = start;
+
+			static constexpr uint32_t hash(uint32_t value)
+			{
+				return value;
+			}
+		};
+
+		template<size_t start, typename Field, typename ... Fields>
+		struct layout_builder<start, Field, Fields...>
+		{
+			static constexpr size_t offset = align_offset(start, Field::alignment);
+
+			using next = layout_builder<(offset + Field::size), Fields...>;
+
+			static constexpr size_t end = next::end;
+
+			static constexpr uint32_t hash(uint32_t value)
+			{
+				return next::hash(hash_layout_value(hash_layout_value(hash_layout_value(value, Field::identifier), offset), Field::size));
+			}
+		};
+
+		// Checks that no field appears twice, and that no two fields share an identifier
+		template<typename Field, typename ... Fields>
+		struct layout_unique;
+
+		template<typename Field>
+		struct layout_unique<Field>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename Field, typename Other, typename ... Fields>
+		struct layout_unique<Field, Other, Fields...>
+		{
+			static constexpr bool value = (Field::identifier != Other::identifier) && layout_unique<Field, Fields...>::value;
+		};
+
+		template<typename Field, typename ... Fields>
+		struct layout_unique<Field, Field, Fields...>
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename ... Fields>
+		struct layout_distinct;
+
+		template<>
+		struct layout_distinct<>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename Field, typename ... Fields>
+		struct layout_distinct<Field, Fields...>
+		{
+			static constexpr bool value = layout_unique<Field, Fields...>::value && layout_distinct<Fields...>::value;
+		};
+
+		// Finds the offset of the field 'Tag'.
+		// Fails to compile if the layout doesn't contain 'Tag'.
+		template<typename Tag, size_t start, typename ... Fields>
+		struct layout_find;
+
+		template<typename Tag, size_t start, typename Field, typename ... Fields>
+		struct layout_find<Tag, start, Field, Fields...> :
+			layout_find<Tag, (align_offset(start, Field::alignment) + Field::size), Fields...>
+		{
+		};
+
+		template<typename Tag, size_t start, typename ... Fields>
+		struct layout_find<Tag, start, Tag, Fields...>
+		{
+			static constexpr size_t offset = align_offset(start, Tag::alignment);
+		};
+
+		// Creates the handle type for a field
+		template<typename Type>
+		struct layout_handle
+		{
+			using type = EepromReference<Type>;
+
+			static type make(uintptr_t address)
+			{
+				return type(reinterpret_cast<Type *>(address));
+			}
+		};
+
+		template<typename Type, size_t size>
+		struct layout_handle<Type[size]>
+		{
+			using type = EepromArray<Type, size>;
+
+			static type make(uintptr_t address)
+			{
+				return type(reinterpret_cast<Type *>(address));
+			}
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+// For uint8_t, uintptr_t
+#include <stdint.h>
+
+// For EECR, EEAR, EEDR, EEPM0, EEPM1
+#include <avr/io.h>
+
+#include "interrupt_details.h"
+
+namespace eeprom
+{
+	namespace details
+	{
+		// The eeprom programming modes.
+		// Erasing sets every bit of a byte, and writing can only clear bits,
+		// so a separate erase or write takes about half as long as doing both.
+		constexpr uint8_t eeprom_mode_mask = (_BV(EEPM1) | _BV(EEPM0));
+		constexpr uint8_t eeprom_mode_erase_and_write = 0;
+		constexpr uint8_t eeprom_mode_erase_only = _BV(EEPM0);
+		constexpr uint8_t eeprom_mode_write_only = _BV(EEPM1);
+
+		inline bool eeprom_write_in_progress()
+		{
+			return ((EECR & _BV(EEPE)) != 0);
+		}
+
+		// Returns the cheapest mode that changes 'old_value' into 'new_value'
+		constexpr uint8_t eeprom_mode_for(uint8_t old_value, uint8_t new_value)
+		{
+			return (new_value == 0xFF) ? eeprom_mode_erase_only :
+				((old_value & new_value) == new_value) ? eeprom_mode_write_only :
+				eeprom_mode_erase_and_write;
+		}
+
+		// Starts programming a single byte, without waiting for it to finish.
+		// Must only be called when no eeprom write is in progress.
+		inline void program_eeprom_byte(uint8_t * address, uint8_t value, uint8_t mode)
+		{
+			interrupt_lock lock;
+
+			// The mode can only be changed while no write is in progress
+			EECR = static_cast<uint8_t>((EECR & ~eeprom_mode_mask) | mode);
+
+			EEAR = reinterpret_cast<uintptr_t>(address);
+			EEDR = value;
+
+			// Setting EEPE must follow EEMPE within four cycles
+			EECR |= _BV(EEMPE);
+			EECR |= _BV(EEPE);
+		}
+	}
+}
\ No newline at end of file
@@ -9,6 +9,8 @@
 // For eeprom_read_block, eeprom_read_byte, ..., eeprom_read_ptr
 #include <avr/eeprom.h>
 
+#include "../../utils/Array.h"
+
 namespace eeprom
 {
 	namespace details
@@ -45,10 +47,24 @@ namespace eeprom
 			return read_eeprom_helper<Type>::read_eeprom(object);
 		}
 
-		// A type-safe read function for arrays,
-		// intentionally deleted until it's implemented
+		// A type-safe read function for a range of array elements
+		template<size_t offset, size_t count, typename Type, size_t size>
+		utils::Array<Type, count> read_eeprom_range(const Type (& array)[size])
+		{
+			static_assert(count > 0, "count must be greater than 0");
+			static_assert((offset + count) <= size, "The range must lie within the array");
+
+			utils::Array<Type, count> result;
+			eeprom_read_block(result.data(), &array[offset], sizeof(Type) * count);
+			return result;
+		}
+
+		// A type-safe read function for arrays
 		template<typename Type, size_t size>
-		void read_eeprom(const Type (& array)[size]) = delete;
+		utils::Array<Type, size> read_eeprom(const Type (& array)[size])
+		{
+			return read_eeprom_range<0, size>(array);
+		}
 
 		// A type-safe read function for pointers
 		template<typename Type>
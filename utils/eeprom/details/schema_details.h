@@ -0,0 +1,74 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+namespace eeprom
+{
+	namespace details
+	{
+		// The number of bytes moved through RAM at a time during a migration
+		constexpr size_t schema_window_size = 8;
+
+		// The progress of a migration, saved after every chunk.
+		// The position only applies while the stored version equals 'version'.
+		struct schema_progress
+		{
+			uint8_t version;
+			uint16_t position;
+		};
+
+		constexpr size_t max_size(size_t left, size_t right)
+		{
+			return (left > right) ? left : right;
+		}
+
+		template<typename ... Schemas>
+		struct schema_max_size;
+
+		template<>
+		struct schema_max_size<>
+		{
+			static constexpr size_t value = 0;
+		};
+
+		template<typename Schema, typename ... Schemas>
+		struct schema_max_size<Schema, Schemas...>
+		{
+			static constexpr size_t value = max_size(sizeof(typename Schema::value_type), schema_max_size<Schemas...>::value);
+		};
+
+		template<typename ... Schemas>
+		struct schema_last;
+
+		template<typename Schema>
+		struct schema_last<Schema>
+		{
+			using type = Schema;
+		};
+
+		template<typename Schema, typename ... Schemas>
+		struct schema_last<Schema, Schemas...>
+		{
+			using type = typename schema_last<Schemas...>::type;
+		};
+
+		template<typename ... Schemas>
+		struct schema_versions_ascending;
+
+		template<typename Schema>
+		struct schema_versions_ascending<Schema>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename First, typename Second, typename ... Schemas>
+		struct schema_versions_ascending<First, Second, Schemas...>
+		{
+			static constexpr bool value = (First::version < Second::version) && schema_versions_ascending<Second, Schemas...>::value;
+		};
+	}
+}
\ No newline at end of file
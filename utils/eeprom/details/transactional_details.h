@@ -0,0 +1,20 @@
+#pragma once
+
+// For uint16_t
+#include <stdint.h>
+
+namespace eeprom
+{
+	namespace details
+	{
+		// The layout of a single slot of a Transactional in eeprom,
+		// shared by every writer so that they can all use the same storage
+		template<typename Type>
+		struct transactional_slot
+		{
+			uint16_t generation;
+			Type value;
+			uint16_t crc;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+// For uint8_t
+#include <stdint.h>
+
+namespace eeprom
+{
+	namespace details
+	{
+		// The layout of a single slot of a WearLevelled in eeprom,
+		// shared by every writer so that they can all use the same storage
+		template<typename Type>
+		struct wear_levelled_slot
+		{
+			uint8_t sequence;
+			Type value;
+		};
+	}
+}
\ No newline at end of file
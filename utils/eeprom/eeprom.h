@@ -5,6 +5,8 @@ namespace eeprom {}
 #include "readEeprom.h"
 #include "writeEeprom.h"
 #include "overwriteEeprom.h"
+#include "updateEeprom.h"
+#include "asyncWrite.h"
 
 #include "EepromReference.h"
 #include "specialisations/EepromReference_const.h"
@@ -12,5 +14,21 @@ namespace eeprom {}
 #include "EepromPointer.h"
 #include "specialisations/EepromPointer_const.h"
 
-#include "EepromArray.h"
-#include "specialisations/EepromArray_const.h"
\ No newline at end of file
+#include "EepromArray.h"
+#include "copy.h"
+#include "specialisations/EepromArray_const.h"
+
+#include "EepromColumnIterator.h"
+#include "EepromGrid.h"
+
+#include "CachedEepromReference.h"
+#include "CachedEepromArray.h"
+#include "EepromCache.h"
+
+#include "WearLevelled.h"
+#include "EepromWriter.h"
+#include "Transactional.h"
+#include "Layout.h"
+#include "KeyValueStore.h"
+#include "SchemaMigrator.h"
+#include "Schema.h"
\ No newline at end of file
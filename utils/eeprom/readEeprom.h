@@ -38,8 +38,36 @@ namespace eeprom
 	/// Calling this function on an object that is not stored in eeprom
 	/// will result in <strong>undefined behaviour</strong>.
 	///
-	/// @todo
-	/// This function is presently unimplemented.
+	/// @details
+	/// The whole array is copied with a single block read.
 	template<typename Type, size_t size>
-	utils::Array<Type, size> readEeprom(const Type (& array)[size]) = delete;
+	utils::Array<Type, size> readEeprom(const Type (& array)[size])
+	{
+		return details::read_eeprom(array);
+	}
+
+	/// @brief
+	/// Reads `count` elements of an array from eeprom, starting from the element at `offset`.
+	///
+	/// @details
+	/// Only the requested elements are copied, with a single block read.
+	/// The range is checked at compile time.
+	///
+	/// E.g.
+	/// ```
+	/// const auto row = eeprom::readEeprom<16, 8>(tiles);
+	/// ```
+	///
+	/// @note
+	/// The object type must be trivially copyable.
+	///
+	/// @warning
+	/// There is no way to verify that the provided reference refers to an array in eeprom.
+	/// Calling this function on an object that is not stored in eeprom
+	/// will result in <strong>undefined behaviour</strong>.
+	template<size_t offset, size_t count, typename Type, size_t size>
+	utils::Array<Type, count> readEeprom(const Type (& array)[size])
+	{
+		return details::read_eeprom_range<offset, count>(array);
+	}
 }
\ No newline at end of file
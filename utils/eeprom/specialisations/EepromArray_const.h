@@ -3,6 +3,9 @@
 // For size_t
 #include <stddef.h>
 
+// For eeprom_read_block
+#include <avr/eeprom.h>
+
 #include "../EepromReference.h"
 #include "../EepromPointer.h"
 #include "../EepromArray.h"
@@ -203,6 +206,22 @@ namespace eeprom
 		{
 			return const_pointer(&this->elements[end_index]);
 		}
+
+		/// @brief
+		/// Copies `count` elements, starting at index `first`, into `output`.
+		///
+		/// @details
+		/// Reads the elements as a single block,
+		/// which is considerably faster than reading them one at a time through iterators.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing a range that extends beyond the end of the array
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		void readRange(size_type first, size_type count, value_type * output) const
+		{
+			eeprom_read_block(output, &this->elements[first], count * sizeof(value_type));
+		}
 	};
 
 	/// @brief
@@ -92,6 +92,18 @@ namespace eeprom
 		{
 			return eeprom::readEeprom(*this->pointer);
 		}
+
+		/// @brief
+		/// Returns an @ref EepromReference to a member of the object in eeprom.
+		///
+		/// @details
+		/// Reading through the returned reference
+		/// only accesses the bytes of that member.
+		template<typename Member, typename Class>
+		EepromReference<const Member> member(Member Class::* member) const
+		{
+			return EepromReference<const Member>(&(this->pointer->*member));
+		}
 	};
 
 	/// @brief
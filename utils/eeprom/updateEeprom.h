@@ -0,0 +1,81 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+#include "WriteStatistics.h"
+#include "details/diff_details.h"
+
+namespace eeprom
+{
+	/// @brief
+	/// Writes an object to eeprom, changing only the bytes that differ,
+	/// and reports how much work was done.
+	///
+	/// @details
+	/// Like @ref writeEeprom, bytes that already hold their new value are not written.
+	/// In addition, each changed byte is programmed in the cheapest mode:
+	/// a byte whose bits only need to be cleared is written without being erased,
+	/// and a byte being set to `0xFF` is erased without being written.
+	/// Each of those takes about half as long as erasing and writing,
+	/// and the first avoids an erase cycle altogether.
+	///
+	/// The existing contents are read from eeprom 16 bytes at a time.
+	///
+	/// E.g.
+	/// ```
+	/// const auto statistics = eeprom::updateEeprom(save, newSave);
+	///
+	/// totalWritten += statistics.written;
+	/// ```
+	///
+	/// @note
+	/// The object type must be trivially copyable.
+	///
+	/// @warning
+	/// There is no way to verify that the provided reference refers to an object in eeprom.
+	/// Calling this function on an object that is not stored in eeprom
+	/// will result in <strong>undefined behaviour</strong>.
+	template<typename Type>
+	WriteStatistics updateEeprom(Type & destination, const Type & source)
+	{
+		return details::update_eeprom_diff(reinterpret_cast<uint8_t *>(&destination), reinterpret_cast<const uint8_t *>(&source), sizeof(Type));
+	}
+
+	/// @brief
+	/// Writes an object to eeprom, comparing against a copy of its current contents held in RAM,
+	/// and reports how much work was done.
+	///
+	/// @details
+	/// Behaves the same as @ref updateEeprom(Type &, const Type &),
+	/// but never reads eeprom.
+	/// `shadow` is updated to match the new contents.
+	///
+	/// @warning
+	/// `shadow` must hold the current contents of `destination`.
+	/// Otherwise bytes may be left unchanged or programmed in the wrong mode.
+	///
+	/// @warning
+	/// There is no way to verify that the provided reference refers to an object in eeprom.
+	/// Calling this function on an object that is not stored in eeprom
+	/// will result in <strong>undefined behaviour</strong>.
+	template<typename Type>
+	WriteStatistics updateEeprom(Type & destination, const Type & source, Type & shadow)
+	{
+		return details::update_eeprom_shadow(reinterpret_cast<uint8_t *>(&destination), reinterpret_cast<const uint8_t *>(&source), reinterpret_cast<uint8_t *>(&shadow), sizeof(Type));
+	}
+
+	/// @brief
+	/// A writer that writes to eeprom in the same way as @ref updateEeprom,
+	/// for classes such as @ref SchemaMigrator that accept a writer like @ref EepromWriter.
+	struct EepromUpdater
+	{
+		static void write(void * destination, const void * source, size_t size)
+		{
+			static_cast<void>(details::update_eeprom_diff(static_cast<uint8_t *>(destination), static_cast<const uint8_t *>(source), size));
+		}
+	};
+}
\ No newline at end of file
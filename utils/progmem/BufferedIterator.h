@@ -0,0 +1,233 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+// For memcpy_P
+#include <avr/pgmspace.h>
+
+#include "ProgmemArray.h"
+
+namespace progmem
+{
+	// Predeclare as a precaution
+	template<typename Type, size_t chunk_size>
+	class BufferedRange;
+
+	/// @brief
+	/// A forward iterator over a @ref BufferedRange.
+	///
+	/// @details
+	/// The iterator holds only a pointer to its range and a progmem address,
+	/// so it may be copied freely.
+	/// Dereferencing it reads the chunk containing the current element
+	/// into the range's buffer, if that chunk isn't already there.
+	///
+	/// @warning
+	/// References obtained by dereferencing the iterator are only valid
+	/// until another chunk is read into the range's buffer,
+	/// or the range is destroyed.
+	template<typename Type, size_t chunk_size>
+	class BufferedIterator
+	{
+	public:
+		/// @brief
+		/// The type of the elements.
+		using value_type = Type;
+
+		/// @brief
+		/// The signed integer type used for measuring the distance between elements.
+		using difference_type = ptrdiff_t;
+
+		/// @brief
+		/// The type returned by dereferencing the iterator.
+		using reference = const value_type &;
+
+		/// @brief
+		/// The type returned by the member access operator.
+		using pointer = const value_type *;
+
+		/// @brief
+		/// The type of range iterated over.
+		using range_type = BufferedRange<Type, chunk_size>;
+
+	private:
+		range_type * range;
+
+		// The progmem address of the current element
+		const value_type * position;
+
+	public:
+		/// @brief
+		/// Constructs an iterator over `range` that refers to the element at `position`.
+		///
+		/// @details
+		/// Used by @ref BufferedRange, rather than directly.
+		constexpr BufferedIterator(range_type * range, const value_type * position) :
+			range(range), position(position)
+		{
+		}
+
+		reference operator *() const
+		{
+			return this->range->load(this->position);
+		}
+
+		pointer operator ->() const
+		{
+			return &this->range->load(this->position);
+		}
+
+		BufferedIterator & operator ++()
+		{
+			++this->position;
+			return *this;
+		}
+
+		BufferedIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+
+		/// @brief
+		/// Returns a pointer to the current element in progmem.
+		ProgmemPointer<value_type> base() const
+		{
+			return ProgmemPointer<value_type>(this->position);
+		}
+
+		friend bool operator ==(const BufferedIterator & left, const BufferedIterator & right)
+		{
+			return (left.position == right.position);
+		}
+
+		friend bool operator !=(const BufferedIterator & left, const BufferedIterator & right)
+		{
+			return (left.position != right.position);
+		}
+	};
+
+	/// @brief
+	/// A range over an array in progmem that reads
+	/// `chunk_size` elements at a time into a buffer in RAM.
+	///
+	/// @details
+	/// Iterating a @ref ProgmemArray through @ref ProgmemPointer
+	/// reads each element from progmem every time it is dereferenced,
+	/// and reading a member through @ref ProgmemReference reads the whole element.
+	///
+	/// A @ref BufferedRange instead reads `chunk_size` elements with a single call
+	/// to `memcpy_P`, and its iterators serve dereferences as ordinary references into RAM,
+	/// so members can be accessed repeatedly for no further cost.
+	///
+	/// The range holds the only buffer,
+	/// so it uses `chunk_size * sizeof(Type)` bytes of RAM however many iterators are copied.
+	///
+	/// E.g.
+	/// ```
+	/// for(const Enemy & enemy : progmem::makeBufferedRange<4>(enemies))
+	/// 	spawn(enemy.x, enemy.y, enemy.speed);
+	/// ```
+	///
+	/// @warning
+	/// Iterators refer to the range, so must not be used after the range has been destroyed.
+	template<typename Type, size_t chunk_size>
+	class BufferedRange
+	{
+		static_assert(chunk_size > 0, "chunk_size must be greater than 0");
+		static_assert(chunk_size < 256, "chunk_size must be less than 256");
+
+		friend class BufferedIterator<Type, chunk_size>;
+
+	public:
+		/// @brief
+		/// The type of the elements.
+		using value_type = Type;
+
+		/// @brief
+		/// The type of the iterators.
+		using iterator = BufferedIterator<Type, chunk_size>;
+
+	private:
+		// The progmem addresses of the first element and the element after the last
+		const value_type * first;
+		const value_type * last;
+
+		// The progmem address of the first element in the buffer,
+		// and the number of elements in the buffer
+		const value_type * chunk;
+		uint8_t count;
+
+		value_type buffer[chunk_size];
+
+	public:
+		/// @brief
+		/// Constructs a range over the elements of the progmem range [`first`, `last`).
+		///
+		/// @details
+		/// Nothing is read until an iterator is dereferenced.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided pointers point to an array in progmem.
+		/// Providing pointers to anything else will result in <strong>undefined behaviour</strong>.
+		BufferedRange(const value_type * first, const value_type * last) :
+			first(first), last(last), chunk(nullptr), count(0)
+		{
+		}
+
+		iterator begin()
+		{
+			return iterator(this, this->first);
+		}
+
+		iterator end()
+		{
+			return iterator(this, this->last);
+		}
+
+	private:
+		// Reads the chunk starting at 'position' unless it is already buffered
+		const value_type & load(const value_type * position)
+		{
+			if((this->chunk == nullptr) || (position < this->chunk) || (position >= (this->chunk + this->count)))
+			{
+				const size_t remaining = static_cast<size_t>(this->last - position);
+
+				this->chunk = position;
+				this->count = static_cast<uint8_t>((remaining < chunk_size) ? remaining : chunk_size);
+
+				static_cast<void>(memcpy_P(&this->buffer[0], position, this->count * sizeof(value_type)));
+			}
+
+			return this->buffer[position - this->chunk];
+		}
+	};
+
+	/// @brief
+	/// Returns a range that iterates over an array in progmem
+	/// `chunk_size` elements at a time. See @ref BufferedRange.
+	///
+	/// @warning
+	/// There is no way of verifying that the provided reference refers to an array in progmem.
+	/// Calling this function on an array that is not stored in progmem
+	/// will result in <strong>undefined behaviour</strong>.
+	template<size_t chunk_size, typename Type, size_t capacity>
+	BufferedRange<Type, chunk_size> makeBufferedRange(const Type (& array)[capacity])
+	{
+		return BufferedRange<Type, chunk_size>(&array[0], &array[capacity]);
+	}
+
+	/// @brief
+	/// Returns a range that iterates over a @ref ProgmemArray
+	/// `chunk_size` elements at a time. See @ref BufferedRange.
+	template<size_t chunk_size, typename Type, size_t capacity>
+	BufferedRange<Type, chunk_size> makeBufferedRange(const ProgmemArray<Type, capacity> & array)
+	{
+		return BufferedRange<Type, chunk_size>(static_cast<const Type *>(array.begin()), static_cast<const Type *>(array.end()));
+	}
+}
\ No newline at end of file
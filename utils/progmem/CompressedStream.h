@@ -0,0 +1,297 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For pgm_read_byte
+#include <avr/pgmspace.h>
+
+namespace progmem
+{
+	/// @brief
+	/// Decompresses LZSS-compressed data directly from progmem,
+	/// one byte at a time, without first copying it into RAM.
+	///
+	/// @details
+	/// The data must be produced by `tools/compress_progmem.py`,
+	/// which emits a header containing a progmem array
+	/// along with the window size the data was compressed with.
+	///
+	/// The only RAM used is the window of recently decoded bytes,
+	/// which back-references are copied from, plus 11 bytes of state.
+	///
+	/// E.g.
+	/// ```
+	/// #include "title_screen.h"
+	///
+	/// progmem::CompressedStream<title_screen_window_size> stream(title_screen);
+	///
+	/// uint8_t row[128];
+	///
+	/// while(stream.available() > 0)
+	/// {
+	/// 	stream.read(row, sizeof(row));
+	/// 	drawRow(row);
+	/// }
+	/// ```
+	///
+	/// @tparam window_size
+	/// The size of the window, in bytes.
+	/// Must be a power of two no larger than 4096,
+	/// and no smaller than the window size the data was compressed with.
+	template<size_t window_size>
+	class CompressedStream
+	{
+		static_assert((window_size > 0) && ((window_size & (window_size - 1)) == 0), "window_size must be a power of two");
+		static_assert(window_size <= 4096, "window_size must be no larger than 4096");
+
+	public:
+		/// @brief
+		/// The unsigned integer type used for measuring sizes.
+		using size_type = size_t;
+
+		class Iterator;
+
+	private:
+		static constexpr uint16_t window_mask = static_cast<uint16_t>(window_size - 1);
+		static constexpr uint8_t minimum_match = 3;
+
+	private:
+		// The next compressed byte
+		const uint8_t * source;
+
+		// The number of decompressed bytes not yet read
+		uint16_t remaining;
+
+		// The distance and remaining length of the back-reference being copied
+		uint16_t match_distance;
+		uint8_t match_remaining;
+
+		// The flags of the current group, and the number not yet used
+		uint8_t flags;
+		uint8_t flag_count;
+
+		// The total number of bytes decoded, which wraps around the window
+		uint16_t position;
+
+		// The most recently decoded bytes
+		uint8_t window[window_size];
+
+	public:
+		/// @brief
+		/// Creates a stream that decompresses the provided data.
+		///
+		/// @warning
+		/// There is no way to verify that the provided pointer points to data in progmem,
+		/// nor that the data was produced by the compression tool.
+		/// Providing anything else will result in <strong>undefined behaviour</strong>.
+		explicit CompressedStream(const uint8_t * data) :
+			source(data + 2),
+			remaining(static_cast<uint16_t>(pgm_read_byte(&data[0]) | (pgm_read_byte(&data[1]) << 8))),
+			match_distance(0),
+			match_remaining(0),
+			flags(0),
+			flag_count(0),
+			position(0)
+		{
+		}
+
+		/// @brief
+		/// Returns the number of decompressed bytes that have yet to be read.
+		size_type available() const
+		{
+			return this->remaining;
+		}
+
+		/// @brief
+		/// Returns `true` if every byte has been read, otherwise returns `false`.
+		bool empty() const
+		{
+			return (this->remaining == 0);
+		}
+
+		/// @brief
+		/// Returns the next decompressed byte,
+		/// or `-1` if every byte has already been read.
+		int read()
+		{
+			if(this->remaining == 0)
+				return -1;
+
+			--this->remaining;
+			return this->decode();
+		}
+
+		/// @brief
+		/// Decompresses up to `count` bytes into `buffer`.
+		///
+		/// @return
+		/// The number of bytes read,
+		/// which is less than `count` only if the end of the data was reached.
+		size_type read(uint8_t * buffer, size_type count)
+		{
+			if(count > this->remaining)
+				count = this->remaining;
+
+			for(size_type index = 0; index < count; ++index)
+				buffer[index] = this->decode();
+
+			this->remaining -= static_cast<uint16_t>(count);
+
+			return count;
+		}
+
+		/// @brief
+		/// Discards up to `count` decompressed bytes.
+		///
+		/// @return
+		/// The number of bytes discarded.
+		size_type skip(size_type count)
+		{
+			if(count > this->remaining)
+				count = this->remaining;
+
+			for(size_type index = 0; index < count; ++index)
+				static_cast<void>(this->decode());
+
+			this->remaining -= static_cast<uint16_t>(count);
+
+			return count;
+		}
+
+		/// @brief
+		/// Returns an input iterator over the remaining bytes.
+		///
+		/// @note
+		/// Reading through the iterator consumes bytes from the stream.
+		Iterator begin()
+		{
+			return Iterator(this);
+		}
+
+		/// @brief
+		/// Returns the end iterator.
+		Iterator end()
+		{
+			return Iterator();
+		}
+
+	private:
+		uint8_t put(uint8_t value)
+		{
+			this->window[this->position & window_mask] = value;
+			++this->position;
+			return value;
+		}
+
+		uint8_t decode()
+		{
+			if(this->match_remaining == 0)
+			{
+				if(this->flag_count == 0)
+				{
+					this->flags = pgm_read_byte(this->source);
+					++this->source;
+					this->flag_count = 8;
+				}
+
+				const bool isLiteral = ((this->flags & 1) != 0);
+
+				this->flags >>= 1;
+				--this->flag_count;
+
+				if(isLiteral)
+				{
+					const uint8_t value = pgm_read_byte(this->source);
+					++this->source;
+					return this->put(value);
+				}
+
+				const uint8_t low = pgm_read_byte(&this->source[0]);
+				const uint8_t high = pgm_read_byte(&this->source[1]);
+				this->source += 2;
+
+				this->match_distance = static_cast<uint16_t>((((high >> 4) << 8) | low) + 1);
+				this->match_remaining = static_cast<uint8_t>((high & 0x0F) + minimum_match);
+			}
+
+			--this->match_remaining;
+
+			// Reading the source before writing means overlapping matches repeat correctly
+			return this->put(this->window[(this->position - this->match_distance) & window_mask]);
+		}
+
+	public:
+		/// @brief
+		/// An input iterator that reads bytes from a @ref CompressedStream.
+		///
+		/// @details
+		/// All end iterators compare equal,
+		/// and an iterator becomes an end iterator once the stream is exhausted.
+		class Iterator
+		{
+		private:
+			CompressedStream * stream;
+			uint8_t value;
+
+		public:
+			/// @brief
+			/// Creates an end iterator.
+			constexpr Iterator() :
+				stream(nullptr), value(0)
+			{
+			}
+
+			/// @brief
+			/// Creates an iterator that reads from `stream`.
+			explicit Iterator(CompressedStream * stream) :
+				stream(stream), value(0)
+			{
+				this->advance();
+			}
+
+			uint8_t operator *() const
+			{
+				return this->value;
+			}
+
+			Iterator & operator ++()
+			{
+				this->advance();
+				return *this;
+			}
+
+			Iterator operator ++(int)
+			{
+				auto result = *this;
+				this->advance();
+				return result;
+			}
+
+			friend bool operator ==(const Iterator & left, const Iterator & right)
+			{
+				return (left.stream == right.stream);
+			}
+
+			friend bool operator !=(const Iterator & left, const Iterator & right)
+			{
+				return (left.stream != right.stream);
+			}
+
+		private:
+			void advance()
+			{
+				if((this->stream == nullptr) || this->stream->empty())
+				{
+					this->stream = nullptr;
+					return;
+				}
+
+				this->value = static_cast<uint8_t>(this->stream->read());
+			}
+		};
+	};
+}
\ No newline at end of file
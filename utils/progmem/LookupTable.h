@@ -0,0 +1,123 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint32_t
+#include <stdint.h>
+
+// For PROGMEM
+#include <avr/pgmspace.h>
+
+// For utils::MakeIndexSequence
+#include "../utils.h"
+
+#include "readProgmem.h"
+#include "ProgmemArray.h"
+#include "details/lookup_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// A table of values stored in progmem,
+	/// generated at compile time by a `constexpr` function object.
+	///
+	/// @details
+	/// `Generator` must be a literal type with a `constexpr` default constructor
+	/// and a `constexpr` function call operator that takes an index
+	/// and returns a value convertible to `Type`.
+	///
+	/// E.g.
+	/// ```
+	/// struct Squares
+	/// {
+	/// 	constexpr uint16_t operator()(size_t index) const
+	/// 	{
+	/// 		return (index * index);
+	/// 	}
+	/// };
+	///
+	/// using SquareTable = progmem::LookupTable<uint16_t, 256, Squares>;
+	///
+	/// uint16_t square = SquareTable::get(12);
+	/// uint16_t between = SquareTable::interpolate<8>(0x0C80);
+	/// ```
+	template<typename Type, size_t capacity, typename Generator>
+	class LookupTable
+	{
+		static_assert(capacity > 0, "LookupTable cannot be empty");
+
+	public:
+		/// @brief
+		/// The type of the elements stored in the table.
+		using value_type = Type;
+
+		/// @brief
+		/// The unsigned integer type used to represent table indices.
+		using size_type = size_t;
+
+		/// @brief
+		/// The @ref ProgmemArray type that refers to the table.
+		using array_type = ProgmemArray<value_type, capacity>;
+
+	public:
+		/// @brief
+		/// The generated values.
+		static constexpr details::constant_array<value_type, capacity> values PROGMEM =
+			details::make_lookup_table<value_type>(Generator(), utils::MakeIndexSequence<capacity>());
+
+	public:
+		/// @brief
+		/// Returns the number of elements in the table.
+		static constexpr size_type size() noexcept
+		{
+			return capacity;
+		}
+
+		/// @brief
+		/// Returns a @ref ProgmemArray that refers to the table.
+		static constexpr array_type array() noexcept
+		{
+			return array_type(&values.values[0]);
+		}
+
+		/// @brief
+		/// Returns a copy of the element at the specified index.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing an `index` that is greater than or equal to
+		/// the size of the table is <strong>undefined behaviour</strong></em>.
+		static value_type get(size_type index)
+		{
+			return progmem::readProgmem(values.values[index]);
+		}
+
+		/// @brief
+		/// Linearly interpolates between adjacent elements.
+		///
+		/// @details
+		/// `position` is a fixed-point index with `fraction_bits` fractional bits,
+		/// so the result costs two reads from progmem, a multiply and a shift.
+		/// Positions beyond the last element return the last element.
+		template<uint8_t fraction_bits>
+		static value_type interpolate(uint32_t position)
+		{
+			static_assert(fraction_bits < 16, "fraction_bits must be less than 16");
+
+			const size_type index = static_cast<size_type>(position >> fraction_bits);
+
+			if(index >= (capacity - 1))
+				return get(capacity - 1);
+
+			const uint32_t fraction = (position & ((static_cast<uint32_t>(1) << fraction_bits) - 1));
+
+			return details::interpolate_linear<fraction_bits>(get(index), get(index + 1), fraction);
+		}
+	};
+
+	// Definitions of the static data members, as required by C++11
+
+	template<typename Type, size_t capacity, typename Generator>
+	constexpr details::constant_array<Type, capacity> LookupTable<Type, capacity, Generator>::values;
+}
\ No newline at end of file
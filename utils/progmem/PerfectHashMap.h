@@ -0,0 +1,256 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint16_t, uint32_t
+#include <stdint.h>
+
+// For PROGMEM, pgm_read_word
+#include <avr/pgmspace.h>
+
+// For utils::MakeIndexSequence
+#include "../utils.h"
+
+#include "readProgmem.h"
+#include "ProgmemPointer.h"
+#include "details/perfect_hash_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// A minimal-RAM perfect hash of a fixed set of integer keys stored in progmem,
+	/// constructed entirely at compile time.
+	///
+	/// @details
+	/// The keys are first split into buckets by one hash.
+	/// Each bucket of `k` keys then owns `k * k` slots,
+	/// and a per-bucket seed is chosen at compile time so that
+	/// a second hash sends each key in the bucket to a different slot.
+	/// (This is the two-level scheme of Fredman, Komlós and Szemerédi.)
+	///
+	/// Lookup reads one bucket descriptor and one slot from progmem,
+	/// and then reads the key stored at the resulting index to confirm the match,
+	/// so every lookup takes `O(1)` time regardless of the number of keys.
+	///
+	/// No RAM is used.
+	///
+	/// @attention
+	/// The tables cost roughly 8 bytes of progmem per key,
+	/// on top of the keys themselves:
+	/// 4 bytes of bucket descriptor per key,
+	/// and on average two 2-byte slots per key.
+	/// Where progmem is tighter than time,
+	/// a sorted key array searched with @ref binarySearch costs nothing extra.
+	///
+	/// @tparam Key An integer type no larger than 32 bits.
+	/// @tparam key_count The number of keys.
+	/// @tparam keys A `constexpr` array of unique keys, which must be stored in progmem.
+	///
+	/// @note
+	/// Construction is `O(n log² n)` at compile time.
+	/// Tables of a few thousand keys are practical,
+	/// but may take several seconds to compile.
+	template<typename Key, size_t key_count, const Key (& keys)[key_count]>
+	class PerfectHash
+	{
+		static_assert(key_count > 0, "PerfectHash requires at least one key");
+		static_assert(key_count < details::perfect_hash_empty_slot, "PerfectHash supports at most 65534 keys");
+
+	public:
+		/// @brief
+		/// The type of the keys.
+		using key_type = Key;
+
+		/// @brief
+		/// The unsigned integer type used to represent key indices.
+		using size_type = size_t;
+
+		/// @brief
+		/// The value returned by @ref indexOf when a key is not present.
+		static constexpr size_type npos = static_cast<size_type>(-1);
+
+		/// @brief
+		/// The number of buckets.
+		static constexpr size_type bucket_count = key_count;
+
+	private:
+		using key_array = details::constant_array<uint32_t, key_count>;
+		using bucket_array = details::constant_array<uint32_t, bucket_count>;
+
+		// Compile-time intermediate tables.
+		// These are only read during compilation and are not referenced by the generated code.
+		static constexpr key_array bucket_keys = details::make_bucket_keys(keys, bucket_count, utils::MakeIndexSequence<key_count>());
+		static constexpr key_array sorted_keys = details::sorter<key_count>::sort(bucket_keys);
+		static constexpr bucket_array bucket_firsts = details::make_bucket_firsts(sorted_keys.values, utils::MakeIndexSequence<bucket_count>());
+		static constexpr bucket_array bucket_sizes = details::make_bucket_sizes(sorted_keys.values, utils::MakeIndexSequence<bucket_count>());
+		static constexpr bucket_array bucket_slot_counts = details::make_bucket_slot_counts(bucket_sizes.values, utils::MakeIndexSequence<bucket_count>());
+		static constexpr bucket_array bucket_seeds = details::make_bucket_seeds(keys, sorted_keys.values, bucket_firsts.values, bucket_sizes.values, utils::MakeIndexSequence<bucket_count>());
+		static constexpr bucket_array slot_offsets = details::prefix_summer<bucket_count>::scan(bucket_slot_counts, 0);
+
+		static_assert(details::max_value(bucket_sizes.values, 0, bucket_count) <= 15, "PerfectHash bucket overflow, the key hash is too poor for this key set");
+		static_assert(details::max_value(bucket_seeds.values, 0, bucket_count) < details::perfect_hash_seed_limit, "PerfectHash could not find a seed, the keys may not be unique");
+
+	public:
+		/// @brief
+		/// The total number of slots.
+		static constexpr size_type slot_count = details::sum_values(bucket_slot_counts.values, 0, bucket_count);
+
+		static_assert(slot_count < details::perfect_hash_empty_slot, "PerfectHash requires too many slots");
+
+	private:
+		// The tables read at runtime
+		static constexpr details::constant_array<details::perfect_hash_bucket_entry, bucket_count> buckets PROGMEM =
+			details::make_buckets(bucket_slot_counts.values, bucket_seeds.values, slot_offsets.values, utils::MakeIndexSequence<bucket_count>());
+
+		static constexpr details::constant_array<uint16_t, slot_count> slots PROGMEM =
+			details::make_slots(keys, sorted_keys.values, bucket_firsts.values, bucket_sizes.values, bucket_seeds.values, slot_offsets.values, utils::MakeIndexSequence<slot_count>());
+
+	public:
+		/// @brief
+		/// Returns the number of keys.
+		static constexpr size_type size() noexcept
+		{
+			return key_count;
+		}
+
+		/// @brief
+		/// Returns the index of `key` within `keys`,
+		/// or @ref npos if `key` is not one of the keys.
+		static size_type indexOf(key_type key)
+		{
+			const auto bucket = progmem::readProgmem(buckets.values[details::perfect_hash_bucket(key, bucket_count)]);
+
+			if(bucket.size == 0)
+				return npos;
+
+			const uint16_t index = pgm_read_word(&slots.values[bucket.offset + details::perfect_hash_slot(key, bucket.seed, bucket.size)]);
+
+			if(index == details::perfect_hash_empty_slot)
+				return npos;
+
+			return (progmem::readProgmem(keys[index]) == key) ? index : npos;
+		}
+
+		/// @brief
+		/// Returns `true` if `key` is one of the keys, otherwise returns `false`.
+		static bool contains(key_type key)
+		{
+			return (indexOf(key) != npos);
+		}
+	};
+
+	// Definitions of the static data members, as required by C++11
+
+	template<typename Key, size_t key_count, const Key (& keys)[key_count]>
+	constexpr typename PerfectHash<Key, key_count, keys>::key_array PerfectHash<Key, key_count, keys>::bucket_keys;
+
+	template<typename Key, size_t key_count, const Key (& keys)[key_count]>
+	constexpr typename PerfectHash<Key, key_count, keys>::key_array PerfectHash<Key, key_count, keys>::sorted_keys;
+
+	template<typename Key, size_t key_count, const Key (& keys)[key_count]>
+	constexpr typename PerfectHash<Key, key_count, keys>::bucket_array PerfectHash<Key, key_count, keys>::bucket_firsts;
+
+	template<typename Key, size_t key_count, const Key (& keys)[key_count]>
+	constexpr typename PerfectHash<Key, key_count, keys>::bucket_array PerfectHash<Key, key_count, keys>::bucket_sizes;
+
+	template<typename Key, size_t key_count, const Key (& keys)[key_count]>
+	constexpr typename PerfectHash<Key, key_count, keys>::bucket_array PerfectHash<Key, key_count, keys>::bucket_slot_counts;
+
+	template<typename Key, size_t key_count, const Key (& keys)[key_count]>
+	constexpr typename PerfectHash<Key, key_count, keys>::bucket_array PerfectHash<Key, key_count, keys>::bucket_seeds;
+
+	template<typename Key, size_t key_count, const Key (& keys)[key_count]>
+	constexpr typename PerfectHash<Key, key_count, keys>::bucket_array PerfectHash<Key, key_count, keys>::slot_offsets;
+
+	template<typename Key, size_t key_count, const Key (& keys)[key_count]>
+	constexpr details::constant_array<details::perfect_hash_bucket_entry, PerfectHash<Key, key_count, keys>::bucket_count> PerfectHash<Key, key_count, keys>::buckets;
+
+	template<typename Key, size_t key_count, const Key (& keys)[key_count]>
+	constexpr details::constant_array<uint16_t, PerfectHash<Key, key_count, keys>::slot_count> PerfectHash<Key, key_count, keys>::slots;
+
+	/// @brief
+	/// A read-only map from a fixed set of integer keys to values,
+	/// with the keys, the values and the hash tables all stored in progmem.
+	///
+	/// @details
+	/// `keys[i]` maps to `values[i]`.
+	/// Lookup takes `O(1)` time. See @ref PerfectHash for details,
+	/// including the progmem cost of the hash tables.
+	///
+	/// @warning
+	/// Both `keys` and `values` must be stored in progmem.
+	/// They are always read with @ref readProgmem,
+	/// so arrays stored in RAM produce <strong>undefined behaviour</strong>.
+	///
+	/// E.g.
+	/// ```
+	/// constexpr uint16_t item_ids[] PROGMEM = { 17, 42, 1003 };
+	/// constexpr ItemStats item_stats[] PROGMEM = { { 1, 2 }, { 3, 4 }, { 5, 6 } };
+	///
+	/// using ItemMap = progmem::PerfectHashMap<uint16_t, ItemStats, 3, item_ids, item_stats>;
+	///
+	/// ItemStats stats = ItemMap::get(42, ItemStats {});
+	/// ```
+	template<typename Key, typename Value, size_t size_value, const Key (& keys)[size_value], const Value (& values)[size_value]>
+	class PerfectHashMap
+	{
+	public:
+		/// @brief
+		/// The type of the keys.
+		using key_type = Key;
+
+		/// @brief
+		/// The type of the values.
+		using mapped_type = Value;
+
+		/// @brief
+		/// The unsigned integer type used for measuring the size of the map.
+		using size_type = size_t;
+
+		/// @brief
+		/// The type that represents a pointer to a value.
+		using const_pointer = ProgmemPointer<mapped_type>;
+
+		/// @brief
+		/// The perfect hash used to locate keys.
+		using hash_type = PerfectHash<key_type, size_value, keys>;
+
+	public:
+		/// @brief
+		/// Returns the number of entries in the map.
+		static constexpr size_type size() noexcept
+		{
+			return size_value;
+		}
+
+		/// @brief
+		/// Returns `true` if `key` is in the map, otherwise returns `false`.
+		static bool contains(key_type key)
+		{
+			return hash_type::contains(key);
+		}
+
+		/// @brief
+		/// Returns a pointer to the value associated with `key`,
+		/// or a null pointer if `key` is not in the map.
+		static const_pointer find(key_type key)
+		{
+			const auto index = hash_type::indexOf(key);
+
+			return (index != hash_type::npos) ?
+				const_pointer(&values[index]) :
+				const_pointer(static_cast<const mapped_type *>(nullptr));
+		}
+
+		/// @brief
+		/// Returns a copy of the value associated with `key`,
+		/// or `fallback` if `key` is not in the map.
+		static mapped_type get(key_type key, const mapped_type & fallback)
+		{
+			const auto index = hash_type::indexOf(key);
+
+			return (index != hash_type::npos) ? progmem::readProgmem(values[index]) : fallback;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+#include "ProgmemReference.h"
+#include "ProgmemPointer.h"
+
+// For utils::gridIndex
+#include "../utils/gridIndex.h"
+
+namespace progmem
+{
+	/// @brief
+	/// An iterator over the elements of a column of a @ref ProgmemGrid,
+	/// which advances by a whole row at a time.
+	template<typename Type, size_t stride>
+	class ProgmemColumnIterator
+	{
+	public:
+		/// @brief
+		/// The type of the elements.
+		using value_type = Type;
+
+		/// @brief
+		/// The signed integer type used for measuring the distance between elements.
+		using difference_type = ptrdiff_t;
+
+	private:
+		// The first element of the column, and the row the iterator refers to.
+		// Only the current element's address is ever computed,
+		// so the end iterator never forms a pointer beyond the array.
+		const value_type * column;
+		size_t row;
+
+	public:
+		/// @brief
+		/// Constructs an iterator referring to row `row` of the column
+		/// whose first element is pointed to by `column`.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided pointer points to an array element in progmem.
+		/// It is thus possible to construct an invalid @ref ProgmemColumnIterator,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr ProgmemColumnIterator(const value_type * column, size_t row) :
+			column(column), row(row)
+		{
+		}
+
+		/// @brief
+		/// Returns a pointer to the element the iterator refers to.
+		///
+		/// @warning
+		/// Do not call this function on a past-the-end iterator.
+		/// <em>Doing so will result in <strong>undefined behaviour</strong></em>.
+		constexpr ProgmemPointer<value_type> base() const
+		{
+			return ProgmemPointer<value_type>(&this->column[utils::gridIndex<stride>(0, this->row)]);
+		}
+
+		constexpr ProgmemReference<value_type> operator *() const
+		{
+			return ProgmemReference<value_type>(&this->column[utils::gridIndex<stride>(0, this->row)]);
+		}
+
+		ProgmemColumnIterator & operator ++()
+		{
+			++this->row;
+			return *this;
+		}
+
+		ProgmemColumnIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+
+		ProgmemColumnIterator & operator --()
+		{
+			--this->row;
+			return *this;
+		}
+
+		ProgmemColumnIterator operator --(int)
+		{
+			auto result = *this;
+			this->operator--();
+			return result;
+		}
+
+		friend constexpr bool operator ==(const ProgmemColumnIterator & left, const ProgmemColumnIterator & right)
+		{
+			return ((left.column == right.column) && (left.row == right.row));
+		}
+
+		friend constexpr bool operator !=(const ProgmemColumnIterator & left, const ProgmemColumnIterator & right)
+		{
+			return ((left.column != right.column) || (left.row != right.row));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+// For uint_farptr_t
+#include <avr/pgmspace.h>
+
+#include "ProgmemFarReference.h"
+#include "ProgmemFarPointer.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Represents an array of objects stored anywhere in progmem,
+	/// including above the first 64KB.
+	///
+	/// @details
+	/// The far equivalent of @ref ProgmemArray.
+	/// Rather than a raw pointer, it holds a 32-bit `uint_farptr_t` address,
+	/// which can be obtained with avr-libc's `pgm_get_far_address` macro.
+	///
+	/// E.g.
+	/// ```
+	/// const progmem::ProgmemFarArray<uint8_t, 4096> tiles(pgm_get_far_address(tile_data));
+	/// ```
+	template<typename Type, size_t capacity>
+	class ProgmemFarArray
+	{
+	public:
+		/// @brief
+		/// The type of the elements stored in the array.
+		using value_type = Type;
+
+		/// @brief
+		/// The unsigned integer type used for measuring the size of the array.
+		/// Also used to represent array indices.
+		using size_type = size_t;
+
+		/// @brief
+		/// The signed integer type used for measuring the distance between array elements.
+		using difference_type = ptrdiff_t;
+
+		/// @brief
+		/// The type that represents a reference to an array element.
+		using reference = ProgmemFarReference<value_type>;
+
+		/// @brief
+		/// The type that represents a reference to a read-only array element.
+		using const_reference = ProgmemFarReference<value_type>;
+
+		/// @brief
+		/// The type that represents a pointer to an array element.
+		using pointer = ProgmemFarPointer<value_type>;
+
+		/// @brief
+		/// The type that represents a pointer to a read-only array element.
+		using const_pointer = ProgmemFarPointer<value_type>;
+
+		/// @brief
+		/// The type used as an iterator to array elements.
+		using iterator = pointer;
+
+		/// @brief
+		/// The type used as an iterator to read-only array elements.
+		using const_iterator = const_pointer;
+
+	private:
+		static constexpr size_type first_index = 0;
+		static constexpr size_type last_index = (capacity - 1);
+
+		static constexpr size_type begin_index = 0;
+		static constexpr size_type end_index = capacity;
+
+	private:
+		uint_farptr_t address;
+
+	private:
+		constexpr uint_farptr_t addressOf(size_type index) const
+		{
+			return (this->address + (static_cast<uint_farptr_t>(index) * sizeof(value_type)));
+		}
+
+	public:
+		/// @brief
+		/// Constructs a @slink{progmem::ProgmemFarArray,ProgmemFarArray}
+		/// that refers to the array at the provided address.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided address refers to an array in progmem.
+		/// It is thus possible to construct an invalid @ref ProgmemFarArray,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr explicit ProgmemFarArray(uint_farptr_t address) :
+			address(address)
+		{
+		}
+
+		/// @brief
+		/// Returns `true` if the array is empty, returns `false` otherwise.
+		constexpr bool empty() const noexcept
+		{
+			return (capacity == 0);
+		}
+
+		/// @brief
+		/// Returns the number of elements in the array.
+		constexpr size_type size() const noexcept
+		{
+			return capacity;
+		}
+
+		/// @brief
+		/// Returns the maximum number of elements in the array.
+		constexpr size_type max_size() const noexcept
+		{
+			return capacity;
+		}
+
+		/// @brief
+		/// Returns a read-only reference to the first element of the array.
+		constexpr const_reference front() const
+		{
+			return const_reference(this->addressOf(first_index));
+		}
+
+		/// @brief
+		/// Returns a read-only reference to the last element of the array.
+		constexpr const_reference back() const
+		{
+			return const_reference(this->addressOf(last_index));
+		}
+
+		/// @brief
+		/// Returns a pointer to the first element of the underlying array.
+		constexpr const_pointer data() const noexcept
+		{
+			return const_pointer(this->addressOf(first_index));
+		}
+
+		/// @brief
+		/// Returns a read-only reference to the element at the specified index.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing an `index` that is greater than or equal to
+		/// @slink{progmem::ProgmemFarArray::size(),`array.size()`}
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		constexpr const_reference operator[](size_type index) const
+		{
+			return const_reference(this->addressOf(index));
+		}
+
+		/// @brief
+		/// Returns a const iterator pointing to the first element of the array.
+		constexpr const_iterator begin() const noexcept
+		{
+			return const_pointer(this->addressOf(begin_index));
+		}
+
+		/// @brief
+		/// Returns a const iterator pointing to the first element of the array.
+		constexpr const_iterator cbegin() const noexcept
+		{
+			return const_pointer(this->addressOf(begin_index));
+		}
+
+		/// @brief
+		/// Returns a past-the-end const iterator pointing beyond the last element of the array.
+		///
+		/// @warning
+		/// Do not attempt to dereference the returned iterator.
+		/// <em>Doing so will result in <strong>undefined behaviour</strong></em>.
+		constexpr const_iterator end() const noexcept
+		{
+			return const_pointer(this->addressOf(end_index));
+		}
+
+		/// @brief
+		/// Returns a past-the-end const iterator pointing beyond the last element of the array.
+		///
+		/// @warning
+		/// Do not attempt to dereference the returned iterator.
+		/// <em>Doing so will result in <strong>undefined behaviour</strong></em>.
+		constexpr const_iterator cend() const noexcept
+		{
+			return const_pointer(this->addressOf(end_index));
+		}
+	};
+
+	/// @brief
+	/// @slink{progmem::ProgmemFarArray<const Type>, ProgmemFarArray<const Type>}
+	/// behaves the same as @slink{progmem::ProgmemFarArray<Type>, ProgmemFarArray<Type>}
+	/// because progmem is implicitly read-only.
+	template<typename Type, size_t capacity>
+	class ProgmemFarArray<const Type, capacity> :
+		public ProgmemFarArray<Type, capacity>
+	{
+		using ProgmemFarArray<Type, capacity>::ProgmemFarArray;
+	};
+}
\ No newline at end of file
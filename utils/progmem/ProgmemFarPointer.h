@@ -0,0 +1,172 @@
+#pragma once
+
+// For ptrdiff_t
+#include <stddef.h>
+
+// For int32_t
+#include <stdint.h>
+
+// For uint_farptr_t
+#include <avr/pgmspace.h>
+
+#include "ProgmemFarReference.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Represents a pointer to an object stored anywhere in progmem,
+	/// including above the first 64KB.
+	///
+	/// @details
+	/// The far equivalent of @ref ProgmemPointer.
+	/// Rather than a raw pointer, it holds a 32-bit `uint_farptr_t` address,
+	/// which can be obtained with avr-libc's `pgm_get_far_address` macro.
+	///
+	/// @note
+	/// This class may be used as an contiguous iterator for
+	/// containers with contiguous elements stored in progmem.
+	template<typename Type>
+	class ProgmemFarPointer
+	{
+	public:
+		/// @brief
+		/// The type of the object referred to by this pointer.
+		using value_type = Type;
+
+	private:
+		uint_farptr_t address;
+
+	public:
+		/// @brief
+		/// Constructs a @ref ProgmemFarPointer that takes on the value of the provided address.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided address refers to an object in progmem.
+		/// It is thus possible to construct an invalid @ref ProgmemFarPointer,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr explicit ProgmemFarPointer(uint_farptr_t address) :
+			address(address)
+		{
+		}
+
+		/// @brief
+		/// Returns the underlying address.
+		///
+		/// @details
+		/// This operator is marked explicit to prevent accidental usage
+		/// and to discourage excessive intentional usage.
+		constexpr explicit operator uint_farptr_t() const
+		{
+			return this->address;
+		}
+
+		/// @brief
+		/// Dereferences the @ref ProgmemFarPointer, creating a @ref ProgmemFarReference,
+		/// which may be implicitly converted to a @ref value_type object.
+		constexpr ProgmemFarReference<value_type> operator *() const
+		{
+			return ProgmemFarReference<value_type>(this->address);
+		}
+
+		/// @brief
+		/// Returns a @ref ProgmemFarReference to the object at the specified offset.
+		///
+		/// @warning
+		/// Do not attempt to use this operator unless the pointer points to an object in an array.
+		constexpr ProgmemFarReference<value_type> operator [](ptrdiff_t offset) const
+		{
+			return ProgmemFarReference<value_type>(this->address + (static_cast<int32_t>(offset) * static_cast<int32_t>(sizeof(value_type))));
+		}
+
+		/// @brief
+		/// Pre-increments the @ref ProgmemFarPointer.
+		///
+		/// @warning
+		/// Do not attempt to use this operator unless the pointer points to an object in an array.
+		ProgmemFarPointer & operator++()
+		{
+			this->address += sizeof(value_type);
+			return *this;
+		}
+
+		/// @brief
+		/// Post-increments the @ref ProgmemFarPointer.
+		///
+		/// @warning
+		/// Do not attempt to use this operator unless the pointer points to an object in an array.
+		ProgmemFarPointer operator++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+
+		/// @brief
+		/// Pre-decrements the @ref ProgmemFarPointer.
+		///
+		/// @warning
+		/// Do not attempt to use this operator unless the pointer points to an object in an array.
+		ProgmemFarPointer & operator--()
+		{
+			this->address -= sizeof(value_type);
+			return *this;
+		}
+
+		/// @brief
+		/// Post-decrements the @ref ProgmemFarPointer.
+		///
+		/// @warning
+		/// Do not attempt to use this operator unless the pointer points to an object in an array.
+		ProgmemFarPointer operator--(int)
+		{
+			auto result = *this;
+			this->operator--();
+			return result;
+		}
+	};
+
+	/// @brief
+	/// @slink{progmem::ProgmemFarPointer<const Type>, ProgmemFarPointer<const Type>}
+	/// behaves the same as @slink{progmem::ProgmemFarPointer<Type>, ProgmemFarPointer<Type>}
+	/// because progmem is implicitly read-only.
+	template<typename Type>
+	class ProgmemFarPointer<const Type> :
+		public ProgmemFarPointer<Type>
+	{
+		using ProgmemFarPointer<Type>::ProgmemFarPointer;
+	};
+
+	/// @brief
+	/// Tests whether two @sref{progmem::ProgmemFarPointer,ProgmemFarPointers} are equal.
+	template<typename Type>
+	constexpr bool operator ==(const ProgmemFarPointer<Type> & left, const ProgmemFarPointer<Type> & right)
+	{
+		return (static_cast<uint_farptr_t>(left) == static_cast<uint_farptr_t>(right));
+	}
+
+	/// @brief
+	/// Tests whether two @sref{progmem::ProgmemFarPointer,ProgmemFarPointers} are not equal.
+	template<typename Type>
+	constexpr bool operator !=(const ProgmemFarPointer<Type> & left, const ProgmemFarPointer<Type> & right)
+	{
+		return (static_cast<uint_farptr_t>(left) != static_cast<uint_farptr_t>(right));
+	}
+
+	/// @brief
+	/// Subtracts two @sref{progmem::ProgmemFarPointer,ProgmemFarPointers},
+	/// returning the difference between them, in elements, as a signed integer.
+	template<typename Type>
+	constexpr int32_t operator -(const ProgmemFarPointer<Type> & left, const ProgmemFarPointer<Type> & right)
+	{
+		return (static_cast<int32_t>(static_cast<uint_farptr_t>(left) - static_cast<uint_farptr_t>(right)) / static_cast<int32_t>(sizeof(Type)));
+	}
+
+	/// @brief
+	/// Adds an offset to a @sref{progmem::ProgmemFarPointer,ProgmemFarPointer},
+	/// and returns the resulting offset pointer.
+	template<typename Type>
+	constexpr ProgmemFarPointer<Type> operator +(const ProgmemFarPointer<Type> & pointer, ptrdiff_t offset)
+	{
+		return ProgmemFarPointer<Type>(static_cast<uint_farptr_t>(pointer) + (static_cast<int32_t>(offset) * static_cast<int32_t>(sizeof(Type))));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+// For uint_farptr_t
+#include <avr/pgmspace.h>
+
+#include "readProgmemFar.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Represents a reference to an object stored anywhere in progmem,
+	/// including above the first 64KB.
+	///
+	/// @details
+	/// The far equivalent of @ref ProgmemReference.
+	/// Rather than a pointer, it holds a 32-bit `uint_farptr_t` address,
+	/// and reads are performed with the `pgm_read_far` functions and `memcpy_PF`.
+	template<typename Type>
+	class ProgmemFarReference
+	{
+	public:
+		/// @brief The type of the object referred to by this reference.
+		using value_type = Type;
+
+	private:
+		uint_farptr_t address;
+
+	public:
+		/// @brief
+		/// Constructs a @ref ProgmemFarReference that refers to the object at the provided address.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided address refers to an object in progmem.
+		/// It is thus possible to construct an invalid @ref ProgmemFarReference,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr explicit ProgmemFarReference(uint_farptr_t address) :
+			address(address)
+		{
+		}
+
+		/// @brief
+		/// Returns the underlying address.
+		///
+		/// @details
+		/// This operator is marked explicit to prevent its accidental use
+		/// and to discourage excessive intentional use.
+		constexpr explicit operator uint_farptr_t() const
+		{
+			return this->address;
+		}
+
+		/// @brief
+		/// Creates a copy of the object in progmem referred to by this @ref ProgmemFarReference.
+		///
+		/// @note
+		/// As with @ref ProgmemReference, this conversion is implicit,
+		/// so it should be used cautiously.
+		operator value_type() const
+		{
+			return progmem::readProgmemFar<value_type>(this->address);
+		}
+	};
+
+	/// @brief
+	/// @slink{progmem::ProgmemFarReference<const Type>, ProgmemFarReference<const Type>}
+	/// behaves the same as @slink{progmem::ProgmemFarReference<Type>, ProgmemFarReference<Type>}
+	/// because progmem is implicitly read-only.
+	template<typename Type>
+	class ProgmemFarReference<const Type> :
+		public ProgmemFarReference<Type>
+	{
+		using ProgmemFarReference<Type>::ProgmemFarReference;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+// For strlen
+#include <string.h>
+
+// For uint_farptr_t
+#include <avr/pgmspace.h>
+
+#include "ProgmemFarReference.h"
+#include "ProgmemFarPointer.h"
+#include "details/read_far_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Represents a string stored anywhere in progmem,
+	/// including above the first 64KB.
+	///
+	/// @details
+	/// The far equivalent of @ref ProgmemString.
+	/// It holds a 32-bit `uint_farptr_t` address,
+	/// which can be obtained with avr-libc's `pgm_get_far_address` macro,
+	/// along with the number of characters.
+	/// As with @ref ProgmemString, @ref size includes the null character if present,
+	/// while @ref length excludes it.
+	///
+	/// E.g.
+	/// ```
+	/// const progmem::ProgmemFarString title(pgm_get_far_address(title_text));
+	///
+	/// char buffer[16];
+	/// buffer[title.copy(buffer, sizeof(buffer) - 1)] = '\0';
+	/// ```
+	class ProgmemFarString
+	{
+	public:
+		/// @brief
+		/// The type of the characters in the string.
+		using value_type = char;
+
+		/// @brief
+		/// The unsigned integer type used for measuring the size of the string.
+		using size_type = size_t;
+
+		/// @brief
+		/// The signed integer type used for measuring the distance between characters.
+		using difference_type = ptrdiff_t;
+
+		/// @brief
+		/// The type that represents a reference to a read-only character.
+		using const_reference = ProgmemFarReference<value_type>;
+
+		/// @brief
+		/// The type that represents a pointer to a read-only character.
+		using const_pointer = ProgmemFarPointer<value_type>;
+
+		/// @brief
+		/// The type used as an iterator to read-only characters.
+		using const_iterator = const_pointer;
+
+	private:
+		uint_farptr_t address;
+		size_type string_size;
+
+	public:
+		/// @brief
+		/// Constructs a @ref ProgmemFarString from the null-terminated string at the provided address.
+		///
+		/// @details
+		/// The length is measured with `strlen_PF`,
+		/// and the size includes the null character.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided address refers to a string in progmem.
+		/// It is thus possible to construct an invalid @ref ProgmemFarString,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		explicit ProgmemFarString(uint_farptr_t address) :
+			address(address), string_size(details::far_length(address) + 1)
+		{
+		}
+
+		/// @brief
+		/// Constructs a @ref ProgmemFarString from the `size` characters at the provided address,
+		/// which may include a null character.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided address refers to a string in progmem.
+		/// It is thus possible to construct an invalid @ref ProgmemFarString,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr ProgmemFarString(uint_farptr_t address, size_type size) :
+			address(address), string_size(size)
+		{
+		}
+
+		/// @brief
+		/// Returns `true` if the string contains no characters, returns `false` otherwise.
+		constexpr bool empty() const noexcept
+		{
+			return (this->string_size == 0);
+		}
+
+		/// @brief
+		/// Returns the number of characters in the string.
+		/// This includes the null character if present.
+		constexpr size_type size() const noexcept
+		{
+			return this->string_size;
+		}
+
+		/// @brief
+		/// Returns the number of characters in the string,
+		/// excluding the null character if present.
+		///
+		/// @details
+		/// The copy and comparison functions operate on this many characters.
+		size_type length() const
+		{
+			return ((this->string_size > 0) && (details::far_read_byte(this->address + this->string_size - 1) == '\0')) ?
+				(this->string_size - 1) :
+				this->string_size;
+		}
+
+		/// @brief
+		/// Returns a pointer to the first character of the string.
+		constexpr const_pointer data() const noexcept
+		{
+			return const_pointer(this->address);
+		}
+
+		/// @brief
+		/// Returns a copy of the character at the specified index.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing an `index` that is greater than or equal to
+		/// @slink{progmem::ProgmemFarString::size(),`string.size()`}
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		char operator[](size_type index) const
+		{
+			return static_cast<char>(details::far_read_byte(this->address + index));
+		}
+
+		/// @brief
+		/// Copies up to `count` characters, starting from `position`, into `buffer`.
+		///
+		/// @details
+		/// No null terminator is written.
+		///
+		/// @return
+		/// The number of characters copied.
+		size_type copy(char * buffer, size_type count, size_type position = 0) const
+		{
+			const size_type length = this->length();
+
+			if(position >= length)
+				return 0;
+
+			const size_type remaining = (length - position);
+			const size_type copied = (count < remaining) ? count : remaining;
+
+			details::far_copy(buffer, this->address + position, copied);
+
+			return copied;
+		}
+
+		/// @brief
+		/// Returns `true` if the string has the same contents as
+		/// the null-terminated string `string` in RAM, otherwise returns `false`.
+		bool equals(const char * string) const
+		{
+			const size_type length = this->length();
+
+			return ((strlen(string) == length) && (details::far_compare(string, this->address, length) == 0));
+		}
+
+		/// @brief
+		/// Returns a const iterator pointing to the first character of the string.
+		constexpr const_iterator begin() const noexcept
+		{
+			return const_iterator(this->address);
+		}
+
+		/// @brief
+		/// Returns a past-the-end const iterator pointing beyond the last character of the string.
+		constexpr const_iterator end() const noexcept
+		{
+			return const_iterator(this->address + this->string_size);
+		}
+	};
+
+	/// @brief
+	/// Returns `true` if the strings have the same contents, otherwise returns `false`.
+	inline bool operator ==(const ProgmemFarString & left, const char * right)
+	{
+		return left.equals(right);
+	}
+
+	/// @brief
+	/// Returns `true` if the strings have the same contents, otherwise returns `false`.
+	inline bool operator ==(const char * left, const ProgmemFarString & right)
+	{
+		return right.equals(left);
+	}
+
+	/// @brief
+	/// Returns `true` if the strings have different contents, otherwise returns `false`.
+	inline bool operator !=(const ProgmemFarString & left, const char * right)
+	{
+		return !left.equals(right);
+	}
+
+	/// @brief
+	/// Returns `true` if the strings have different contents, otherwise returns `false`.
+	inline bool operator !=(const char * left, const ProgmemFarString & right)
+	{
+		return !right.equals(left);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+// For utils::gridIndex
+#include "../utils/gridIndex.h"
+
+// For utils::IteratorPair
+#include "../utils/Iterator/IteratorPair.h"
+
+#include "ProgmemReference.h"
+#include "ProgmemPointer.h"
+#include "ProgmemArray.h"
+#include "ProgmemColumnIterator.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Represents a two-dimensional array of objects stored in progmem.
+	///
+	/// @details
+	/// The elements are stored in row-major order,
+	/// exactly as in a plain two-dimensional array `Type[height][width]`,
+	/// so an existing array can be used without modification.
+	///
+	/// When `width` is a power of two, the row offset
+	/// is computed with a shift rather than a multiplication.
+	///
+	/// E.g.
+	/// ```
+	/// constexpr uint8_t map_data[8][16] PROGMEM = { ... };
+	///
+	/// constexpr progmem::ProgmemGrid<uint8_t, 16, 8> map(map_data);
+	///
+	/// uint8_t tile = map(x, y);
+	///
+	/// for(uint8_t tile : map.row(y))
+	/// 	...
+	///
+	/// for(uint8_t tile : map.column(x))
+	/// 	...
+	/// ```
+	template<typename Type, size_t width_value, size_t height_value>
+	class ProgmemGrid
+	{
+		static_assert(width_value > 0, "ProgmemGrid width must be greater than 0");
+		static_assert(height_value > 0, "ProgmemGrid height must be greater than 0");
+
+	public:
+		/// @brief
+		/// The type of the elements stored in the grid.
+		using value_type = Type;
+
+		/// @brief
+		/// The unsigned integer type used for measuring the size of the grid.
+		/// Also used to represent coordinates.
+		using size_type = size_t;
+
+		/// @brief
+		/// The signed integer type used for measuring the distance between elements.
+		using difference_type = ptrdiff_t;
+
+		/// @brief
+		/// The type that represents a reference to a read-only element.
+		using const_reference = ProgmemReference<value_type>;
+
+		/// @brief
+		/// The type that represents a pointer to a read-only element.
+		using const_pointer = ProgmemPointer<value_type>;
+
+		/// @brief
+		/// The type used as an iterator over every element, in row-major order.
+		using const_iterator = const_pointer;
+
+		/// @brief
+		/// The type that represents a single row.
+		using row_type = ProgmemArray<value_type, width_value>;
+
+		/// @brief
+		/// The type used as an iterator over a single column.
+		using column_iterator = ProgmemColumnIterator<value_type, width_value>;
+
+		/// @brief
+		/// The type that represents a single column.
+		using column_type = utils::IteratorPair<column_iterator>;
+
+	private:
+		const value_type * elements;
+
+	public:
+		/// @brief
+		/// Constructs a @ref ProgmemGrid that refers to the provided two-dimensional array.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided reference refers to an array in progmem.
+		/// It is thus possible to construct an invalid @ref ProgmemGrid,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr ProgmemGrid(const value_type (& array)[height_value][width_value]) :
+			elements(&array[0][0])
+		{
+		}
+
+		/// @brief
+		/// Constructs a @ref ProgmemGrid that refers to the provided flat array.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided reference refers to an array in progmem.
+		/// It is thus possible to construct an invalid @ref ProgmemGrid,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr ProgmemGrid(const value_type (& array)[width_value * height_value]) :
+			elements(&array[0])
+		{
+		}
+
+		/// @brief
+		/// Constructs a @ref ProgmemGrid that takes on the value of the provided pointer.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided pointer points to an array in progmem.
+		/// It is thus possible to construct an invalid @ref ProgmemGrid,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr explicit ProgmemGrid(const value_type * pointer) :
+			elements(pointer)
+		{
+		}
+
+		/// @brief
+		/// Returns the number of columns.
+		constexpr size_type width() const noexcept
+		{
+			return width_value;
+		}
+
+		/// @brief
+		/// Returns the number of rows.
+		constexpr size_type height() const noexcept
+		{
+			return height_value;
+		}
+
+		/// @brief
+		/// Returns the total number of elements.
+		constexpr size_type size() const noexcept
+		{
+			return (width_value * height_value);
+		}
+
+		/// @brief
+		/// Returns a pointer to the first element.
+		constexpr const_pointer data() const noexcept
+		{
+			return const_pointer(this->elements);
+		}
+
+		/// @brief
+		/// Returns a read-only reference to the element at (`x`, `y`).
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing an `x` that is greater than or equal to the width,
+		/// or a `y` that is greater than or equal to the height,
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		constexpr const_reference operator()(size_type x, size_type y) const
+		{
+			return const_reference(&this->elements[utils::gridIndex<width_value>(x, y)]);
+		}
+
+		/// @brief
+		/// Returns a @ref ProgmemArray that refers to row `y`.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		constexpr row_type row(size_type y) const
+		{
+			return row_type(&this->elements[utils::gridIndex<width_value>(0, y)]);
+		}
+
+		/// @brief
+		/// Returns a range of the elements in column `x`, from top to bottom.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		column_type column(size_type x) const
+		{
+			return column_type
+			(
+				column_iterator(&this->elements[x], 0),
+				column_iterator(&this->elements[x], height_value)
+			);
+		}
+
+		/// @brief
+		/// Returns a const iterator pointing to the first element, in row-major order.
+		constexpr const_iterator begin() const noexcept
+		{
+			return const_pointer(&this->elements[0]);
+		}
+
+		/// @brief
+		/// Returns a past-the-end const iterator pointing beyond the last element.
+		///
+		/// @warning
+		/// Do not attempt to dereference the returned iterator.
+		/// <em>Doing so will result in <strong>undefined behaviour</strong></em>.
+		constexpr const_iterator end() const noexcept
+		{
+			return const_pointer(&this->elements[width_value * height_value]);
+		}
+	};
+
+	/// @brief
+	/// A simpler way to construct a @ref ProgmemGrid.
+	/// This function allows the type and dimensions to be inferred.
+	///
+	/// @warning
+	/// There is no way of verifying that the provided reference refers to an array in progmem.
+	/// It is thus possible to construct an invalid @ref ProgmemGrid,
+	/// which can lead to <strong>undefined behaviour</strong>.
+	template<typename Type, size_t width, size_t height>
+	constexpr ProgmemGrid<Type, width, height> makeProgmemGrid(const Type (& array)[height][width])
+	{
+		return array;
+	}
+}
\ No newline at end of file
@@ -3,11 +3,15 @@
 // For size_t, ptrdiff_t
 #include <stddef.h>
 
+// For strlen_P
+#include <avr/pgmspace.h>
+
 // For utils::size
 #include "../utils.h"
 
 #include "ProgmemReference.h"
 #include "ProgmemPointer.h"
+#include "details/string_details.h"
 
 // Used by Arduino
 // Redeclaring here shouldn't cause an issue,
@@ -115,14 +119,11 @@ namespace progmem
 		/// @warning
 		/// This function has `O(n)` complexity.
 		/// Use it sparingly, and cache the result.
+		/// If the size is needed frequently, convert to a @ref ProgmemString
+		/// with @ref makeProgmemString, which computes the size only once.
 		size_type size() const noexcept
 		{
-			size_type result = 0;
-
-			for(auto current = this->string; pgm_read_byte(current) != '\0'; ++current)
-				++result;
-
-			return result;
+			return strlen_P(this->string);
 		}
 
 		/// @brief
@@ -192,10 +193,22 @@ namespace progmem
 	/// Tests whether two @sref{progmem::ProgmemNullString,ProgmemNullStrings} are equal.
 	///
 	/// @details
-	/// Returns `true` if the pointers are equal, otherwise returns `false`.
-	constexpr bool operator ==(const ProgmemNullString & left, const ProgmemNullString & right)
+	/// Returns `true` if both strings contain the same characters, otherwise returns `false`.
+	/// The pointers are compared first, so comparing a string with itself costs nothing.
+	/// Otherwise the characters are compared until the first difference,
+	/// without computing the size of either string.
+	inline bool operator ==(const ProgmemNullString & left, const ProgmemNullString & right)
 	{
-		return ((static_cast<const char *>(left) == static_cast<const char *>(right)) && (left.size() == right.size()));
+		const auto left_pointer = static_cast<const char *>(left);
+		const auto right_pointer = static_cast<const char *>(right);
+
+		if(left_pointer == right_pointer)
+			return true;
+
+		if((left_pointer == nullptr) || (right_pointer == nullptr))
+			return false;
+
+		return (details::compare_progmem_strings(left_pointer, right_pointer) == 0);
 	}
 
 	/// @brief
@@ -212,10 +225,10 @@ namespace progmem
 	/// Tests whether two @sref{progmem::ProgmemNullString,ProgmemNullStrings} are not equal.
 	///
 	/// @details
-	/// Returns `true` if the pointers are not equal, otherwise returns `false`.
-	constexpr bool operator !=(const ProgmemNullString & left, const ProgmemNullString & right)
+	/// Returns `true` if the strings contain different characters, otherwise returns `false`.
+	inline bool operator !=(const ProgmemNullString & left, const ProgmemNullString & right)
 	{
-		return ((static_cast<const char *>(left) != static_cast<const char *>(right)) || (left.size() != right.size()));
+		return !(left == right);
 	}
 
 	/// @brief
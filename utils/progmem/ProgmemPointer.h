@@ -79,6 +79,41 @@ namespace progmem
 			return ProgmemReference<value_type>(this->pointer);
 		}
 
+		/// @brief
+		/// Creates a @ref ProgmemReference to a member of the object in progmem,
+		/// without reading the object.
+		///
+		/// @details
+		/// Converting the result reads only `sizeof(Member)` bytes,
+		/// rather than copying the whole object.
+		///
+		/// E.g.
+		/// ```
+		/// uint8_t speed = pointer.member(&Enemy::speed);
+		/// ```
+		template<typename Member, typename Class>
+		constexpr ProgmemReference<Member> member(Member Class::* member) const
+		{
+			return ProgmemReference<Member>(this->pointer->*member);
+		}
+
+		/// @brief
+		/// Creates a @ref ProgmemReference to a member of the object in progmem,
+		/// without reading the object.
+		///
+		/// @details
+		/// Equivalent to @ref member, but allows the same syntax as an ordinary pointer.
+		///
+		/// E.g.
+		/// ```
+		/// uint8_t speed = pointer->*&Enemy::speed;
+		/// ```
+		template<typename Member, typename Class>
+		constexpr ProgmemReference<Member> operator ->*(Member Class::* member) const
+		{
+			return ProgmemReference<Member>(this->pointer->*member);
+		}
+
 		/// @brief
 		/// Pre-increments the @ref ProgmemPointer.
 		///
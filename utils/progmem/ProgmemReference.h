@@ -89,6 +89,25 @@ namespace progmem
 		{
 			return progmem::readProgmem(*this->pointer);
 		}
+
+		/// @brief
+		/// Creates a @ref ProgmemReference to a member of the object in progmem,
+		/// without reading the object.
+		///
+		/// @details
+		/// Converting the result reads only `sizeof(Member)` bytes,
+		/// using the most suitable `pgm_read` function for `Member`,
+		/// rather than copying the whole object.
+		///
+		/// E.g.
+		/// ```
+		/// uint8_t speed = enemies[index].member(&Enemy::speed);
+		/// ```
+		template<typename Member, typename Class>
+		constexpr ProgmemReference<Member> member(Member Class::* member) const
+		{
+			return ProgmemReference<Member>(this->pointer->*member);
+		}
 	};
 
 	/// @brief
@@ -3,7 +3,10 @@
 // For size_t, ptrdiff_t
 #include <stddef.h>
 
-// For PSTR
+// For strlen
+#include <string.h>
+
+// For PSTR, pgm_read_byte, memcmp_P, memchr_P
 #include <avr/pgmspace.h>
 
 // For utils::size
@@ -12,6 +15,7 @@
 #include "ProgmemReference.h"
 #include "ProgmemPointer.h"
 #include "ProgmemNullString.h"
+#include "details/string_details.h"
 
 // Used by Arduino
 // Redeclaring here shouldn't cause an issue,
@@ -33,7 +37,7 @@ namespace progmem
 	/// @warning
 	/// Experimental class, may be removed.
 	/// Use only to test and provide feedback.
-	class ProgmemString
+	class ProgmemString : private details::string_constants<>
 	{
 	public:
 		/// @brief
@@ -73,6 +77,10 @@ namespace progmem
 		/// The type used as an iterator to read-only character.
 		using const_iterator = const_pointer;
 
+		/// @brief
+		/// The value returned by the `find` functions when no match is found.
+		using details::string_constants<>::npos;
+
 	private:
 		const value_type * string;
 		size_type string_size;
@@ -216,6 +224,203 @@ namespace progmem
 			return const_pointer(&this->string[this->string_size]);
 		}
 
+		/// @brief
+		/// Returns the number of characters in the string,
+		/// excluding the null character if present.
+		///
+		/// @details
+		/// All of the comparison and search functions operate on this many characters,
+		/// so a string created with @ref PROGMEM_STRING compares equal to
+		/// the same characters without a null character.
+		size_type length() const
+		{
+			return ((this->string_size > 0) && (pgm_read_byte(&this->string[this->string_size - 1]) == '\0')) ?
+				(this->string_size - 1) :
+				this->string_size;
+		}
+
+		/// @brief
+		/// Lexicographically compares the contents of this string with another string in progmem.
+		///
+		/// @details
+		/// Returns a negative value if this string orders before `other`,
+		/// zero if the strings are equal,
+		/// or a positive value if this string orders after `other`.
+		int compare(const ProgmemString & other) const
+		{
+			const size_type left_length = this->length();
+			const size_type right_length = other.length();
+			const size_type common_length = (left_length < right_length) ? left_length : right_length;
+
+			if(this->string != other.string)
+			{
+				const int result = details::compare_progmem_memory(this->string, other.string, common_length);
+
+				if(result != 0)
+					return result;
+			}
+
+			return (left_length < right_length) ? -1 : (left_length > right_length) ? 1 : 0;
+		}
+
+		/// @brief
+		/// Lexicographically compares the contents of this string with a null-terminated string in RAM.
+		///
+		/// @details
+		/// Returns a negative value if this string orders before `other`,
+		/// zero if the strings are equal,
+		/// or a positive value if this string orders after `other`.
+		int compare(const char * other) const
+		{
+			const size_type left_length = this->length();
+			const size_type right_length = strlen(other);
+			const size_type common_length = (left_length < right_length) ? left_length : right_length;
+
+			// Note: memcmp_P compares RAM against progmem, so the result is negated
+			const int result = -memcmp_P(other, this->string, common_length);
+
+			if(result != 0)
+				return result;
+
+			return (left_length < right_length) ? -1 : (left_length > right_length) ? 1 : 0;
+		}
+
+		/// @brief
+		/// Returns `true` if this string has the same contents as another string in progmem.
+		///
+		/// @details
+		/// The lengths are compared before any characters,
+		/// and strings that share the same pointer are not read at all.
+		bool equals(const ProgmemString & other) const
+		{
+			const size_type size = this->length();
+
+			if(size != other.length())
+				return false;
+
+			if(this->string == other.string)
+				return true;
+
+			return (details::compare_progmem_memory(this->string, other.string, size) == 0);
+		}
+
+		/// @brief
+		/// Returns `true` if this string has the same contents as a null-terminated string in RAM.
+		bool equals(const char * other) const
+		{
+			const size_type size = this->length();
+
+			if(size != strlen(other))
+				return false;
+
+			return (memcmp_P(other, this->string, size) == 0);
+		}
+
+		/// @brief
+		/// Returns the index of the first occurrence of `character`
+		/// at or after `start`, or @ref npos if there is none.
+		size_type find(char character, size_type start = 0) const
+		{
+			const size_type size = this->length();
+
+			if(start >= size)
+				return npos;
+
+			const auto result = static_cast<const char *>(memchr_P(&this->string[start], character, size - start));
+
+			return (result != nullptr) ? static_cast<size_type>(result - this->string) : npos;
+		}
+
+		/// @brief
+		/// Returns the index of the first occurrence of `other`
+		/// at or after `start`, or @ref npos if there is none.
+		size_type find(const ProgmemString & other, size_type start = 0) const
+		{
+			const size_type size = this->length();
+			const size_type other_size = other.length();
+
+			if((start > size) || (other_size > (size - start)))
+				return npos;
+
+			for(size_type index = start; index <= (size - other_size); ++index)
+				if(details::compare_progmem_memory(&this->string[index], other.string, other_size) == 0)
+					return index;
+
+			return npos;
+		}
+
+		/// @brief
+		/// Returns the index of the first occurrence of the null-terminated RAM string `other`
+		/// at or after `start`, or @ref npos if there is none.
+		size_type find(const char * other, size_type start = 0) const
+		{
+			const size_type size = this->length();
+			const size_type other_size = strlen(other);
+
+			if((start > size) || (other_size > (size - start)))
+				return npos;
+
+			for(size_type index = start; index <= (size - other_size); ++index)
+				if(memcmp_P(other, &this->string[index], other_size) == 0)
+					return index;
+
+			return npos;
+		}
+
+		/// @brief
+		/// Returns `true` if this string begins with `character`.
+		bool starts_with(char character) const
+		{
+			return ((this->length() > 0) && (pgm_read_byte(&this->string[0]) == static_cast<unsigned char>(character)));
+		}
+
+		/// @brief
+		/// Returns `true` if this string begins with the contents of `other`.
+		bool starts_with(const ProgmemString & other) const
+		{
+			const size_type other_size = other.length();
+
+			return ((other_size <= this->length()) && (details::compare_progmem_memory(this->string, other.string, other_size) == 0));
+		}
+
+		/// @brief
+		/// Returns `true` if this string begins with the null-terminated RAM string `other`.
+		bool starts_with(const char * other) const
+		{
+			const size_type other_size = strlen(other);
+
+			return ((other_size <= this->length()) && (memcmp_P(other, this->string, other_size) == 0));
+		}
+
+		/// @brief
+		/// Returns `true` if this string ends with `character`.
+		bool ends_with(char character) const
+		{
+			const size_type size = this->length();
+
+			return ((size > 0) && (pgm_read_byte(&this->string[size - 1]) == static_cast<unsigned char>(character)));
+		}
+
+		/// @brief
+		/// Returns `true` if this string ends with the contents of `other`.
+		bool ends_with(const ProgmemString & other) const
+		{
+			const size_type size = this->length();
+			const size_type other_size = other.length();
+
+			return ((other_size <= size) && (details::compare_progmem_memory(&this->string[size - other_size], other.string, other_size) == 0));
+		}
+
+		/// @brief
+		/// Returns `true` if this string ends with the null-terminated RAM string `other`.
+		bool ends_with(const char * other) const
+		{
+			const size_type size = this->length();
+			const size_type other_size = strlen(other);
+
+			return ((other_size <= size) && (memcmp_P(other, &this->string[size - other_size], other_size) == 0));
+		}
+
 		/// @brief
 		/// Returns the underlying raw pointer.
 		///
@@ -259,14 +464,46 @@ namespace progmem
 		}
 	};
 
+	/// @brief
+	/// Creates a @ref ProgmemString from a @ref ProgmemNullString,
+	/// computing the size once so that it need not be recomputed later.
+	///
+	/// @details
+	/// The size of the resulting @ref ProgmemString includes the null character.
+	/// A null @ref ProgmemNullString produces a null @ref ProgmemString.
+	///
+	/// @note
+	/// This function has `O(n)` complexity.
+	inline ProgmemString makeProgmemString(const ProgmemNullString & string)
+	{
+		return (string == nullptr) ?
+			ProgmemString(nullptr) :
+			ProgmemString(static_cast<const char *>(string), string.size() + 1);
+	}
+
 	/// @brief
 	/// Tests whether two @sref{progmem::ProgmemString,ProgmemStrings} are equal.
 	///
 	/// @details
-	/// Returns `true` if the pointers are equal, otherwise returns `false`.
-	constexpr bool operator ==(const ProgmemString & left, const ProgmemString & right)
+	/// Returns `true` if the strings have the same contents, otherwise returns `false`.
+	/// See @ref ProgmemString::equals.
+	inline bool operator ==(const ProgmemString & left, const ProgmemString & right)
+	{
+		return left.equals(right);
+	}
+
+	/// @brief
+	/// Tests whether a @ref ProgmemString has the same contents as a null-terminated string in RAM.
+	inline bool operator ==(const ProgmemString & left, const char * right)
 	{
-		return ((static_cast<const char *>(left) == static_cast<const char *>(right)) && (left.size() == right.size()));
+		return left.equals(right);
+	}
+
+	/// @brief
+	/// Tests whether a null-terminated string in RAM has the same contents as a @ref ProgmemString.
+	inline bool operator ==(const char * left, const ProgmemString & right)
+	{
+		return right.equals(left);
 	}
 
 	/// @brief
@@ -283,10 +520,24 @@ namespace progmem
 	/// Tests whether two @sref{progmem::ProgmemString,ProgmemStrings} are not equal.
 	///
 	/// @details
-	/// Returns `true` if the pointers are not equal, otherwise returns `false`.
-	constexpr bool operator !=(const ProgmemString & left, const ProgmemString & right)
+	/// Returns `true` if the strings have different contents, otherwise returns `false`.
+	inline bool operator !=(const ProgmemString & left, const ProgmemString & right)
+	{
+		return !left.equals(right);
+	}
+
+	/// @brief
+	/// Tests whether a @ref ProgmemString has different contents to a null-terminated string in RAM.
+	inline bool operator !=(const ProgmemString & left, const char * right)
+	{
+		return !left.equals(right);
+	}
+
+	/// @brief
+	/// Tests whether a null-terminated string in RAM has different contents to a @ref ProgmemString.
+	inline bool operator !=(const char * left, const ProgmemString & right)
 	{
-		return ((static_cast<const char *>(left) != static_cast<const char *>(right)) || (left.size() != right.size()));
+		return !right.equals(left);
 	}
 
 	/// @brief
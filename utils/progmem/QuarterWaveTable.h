@@ -0,0 +1,117 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint32_t
+#include <stdint.h>
+
+// For PROGMEM
+#include <avr/pgmspace.h>
+
+// For utils::MakeIndexSequence
+#include "../utils.h"
+
+#include "readProgmem.h"
+#include "details/lookup_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// A table of a periodic, quarter-wave symmetric function (such as sine),
+	/// of which only the first quarter of the period is stored in progmem.
+	///
+	/// @details
+	/// The full period is `4 * quarter_size` phases long,
+	/// and the table stores the `quarter_size + 1` values for phases `0` to `quarter_size`.
+	/// The remaining quarters are derived by reflecting and negating the first quarter,
+	/// which means that `Type` must be signed.
+	///
+	/// `Generator` must be a literal type with a `constexpr` default constructor
+	/// and a `constexpr` function call operator that takes a phase
+	/// and returns a value convertible to `Type`.
+	///
+	/// E.g.
+	/// ```
+	/// // sin(2π * phase / 1024), scaled to 16384
+	/// using SineTable = progmem::QuarterWaveTable<int16_t, 256, Sine>;
+	///
+	/// int16_t value = SineTable::get(angle);
+	/// ```
+	///
+	/// @tparam quarter_size
+	/// The number of phases in a quarter of the period, which must be a power of two.
+	template<typename Type, size_t quarter_size, typename Generator>
+	class QuarterWaveTable
+	{
+		static_assert((quarter_size > 0) && ((quarter_size & (quarter_size - 1)) == 0), "quarter_size must be a power of two");
+		static_assert(Type(-1) < Type(0), "Type must be signed, as the table is negated");
+
+	public:
+		/// @brief
+		/// The type of the elements stored in the table.
+		using value_type = Type;
+
+		/// @brief
+		/// The unsigned integer type used to represent phases.
+		using size_type = size_t;
+
+		/// @brief
+		/// The number of phases in a full period.
+		static constexpr size_type period = (quarter_size * 4);
+
+	public:
+		/// @brief
+		/// The generated values for the first quarter of the period, inclusive of both ends.
+		static constexpr details::constant_array<value_type, quarter_size + 1> values PROGMEM =
+			details::make_lookup_table<value_type>(Generator(), utils::MakeIndexSequence<quarter_size + 1>());
+
+	public:
+		/// @brief
+		/// Returns the value at `phase`, which wraps around the period.
+		static value_type get(size_type phase)
+		{
+			const size_type offset = (phase % quarter_size);
+
+			switch((phase / quarter_size) % 4)
+			{
+				case 0:
+					return progmem::readProgmem(values.values[offset]);
+
+				case 1:
+					return progmem::readProgmem(values.values[quarter_size - offset]);
+
+				case 2:
+					return static_cast<value_type>(-progmem::readProgmem(values.values[offset]));
+
+				default:
+					return static_cast<value_type>(-progmem::readProgmem(values.values[quarter_size - offset]));
+			}
+		}
+
+		/// @brief
+		/// Linearly interpolates between adjacent phases.
+		///
+		/// @details
+		/// `phase` is a fixed-point phase with `fraction_bits` fractional bits,
+		/// which wraps around the period.
+		template<uint8_t fraction_bits>
+		static value_type interpolate(uint32_t phase)
+		{
+			static_assert(fraction_bits < 16, "fraction_bits must be less than 16");
+
+			const size_type index = static_cast<size_type>(phase >> fraction_bits);
+			const uint32_t fraction = (phase & ((static_cast<uint32_t>(1) << fraction_bits) - 1));
+
+			return details::interpolate_linear<fraction_bits>(get(index), get(index + 1), fraction);
+		}
+	};
+
+	// Definitions of the static data members, as required by C++11
+
+	template<typename Type, size_t quarter_size, typename Generator>
+	constexpr details::constant_array<Type, quarter_size + 1> QuarterWaveTable<Type, quarter_size, Generator>::values;
+
+	template<typename Type, size_t quarter_size, typename Generator>
+	constexpr size_t QuarterWaveTable<Type, quarter_size, Generator>::period;
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For pgm_read_byte, pgm_read_word
+#include <avr/pgmspace.h>
+
+#include "readProgmem.h"
+#include "RleIterator.h"
+#include "details/rle_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Represents a run-length encoded array of objects stored in progmem.
+	///
+	/// @details
+	/// The array is stored as a list of runs of equal elements,
+	/// each consisting of a value and a one-byte length,
+	/// along with a checkpoint recording the first element index
+	/// of every 16th run.
+	///
+	/// Accessing an element by index binary searches the checkpoints
+	/// and then scans at most 16 run lengths,
+	/// so it takes `O(log runs)` time.
+	/// Iterating over the elements takes `O(1)` time per element.
+	///
+	/// The interface mirrors @ref ProgmemArray as closely as possible,
+	/// so that code using a @ref ProgmemArray can switch to an @ref RleArray
+	/// by changing the type, with these differences:
+	/// * Elements are returned by value rather than as a @ref ProgmemReference.
+	/// * The iterators are @ref RleIterator rather than @ref ProgmemPointer.
+	/// * There is no `data()`, because the elements are not stored contiguously.
+	///
+	/// An @ref RleArray is usually obtained from an @ref RleEncoding,
+	/// which encodes an ordinary array at compile time.
+	template<typename Type, size_t capacity>
+	class RleArray
+	{
+		static_assert(capacity > 0, "RleArray cannot be empty");
+		static_assert(capacity <= 0xFFFF, "RleArray supports at most 65535 elements");
+
+	public:
+		/// @brief
+		/// The type of the elements stored in the array.
+		using value_type = Type;
+
+		/// @brief
+		/// The unsigned integer type used for measuring the size of the array.
+		/// Also used to represent array indices.
+		using size_type = size_t;
+
+		/// @brief
+		/// The signed integer type used for measuring the distance between array elements.
+		using difference_type = ptrdiff_t;
+
+		/// @brief
+		/// The type returned when accessing an array element.
+		using reference = value_type;
+
+		/// @brief
+		/// The type returned when accessing a read-only array element.
+		using const_reference = value_type;
+
+		/// @brief
+		/// The type used as an iterator to array elements.
+		using iterator = RleIterator<value_type>;
+
+		/// @brief
+		/// The type used as an iterator to read-only array elements.
+		using const_iterator = RleIterator<value_type>;
+
+	private:
+		const value_type * values;
+		const uint8_t * lengths;
+		const uint16_t * checkpoints;
+		size_type runs;
+
+	public:
+		/// @brief
+		/// Constructs an @ref RleArray from run data stored in progmem.
+		///
+		/// @details
+		/// * `values` holds the value of each run.
+		/// * `lengths` holds the length of each run, followed by a `0`.
+		/// * `checkpoints` holds the index of the first element of every 16th run.
+		///
+		/// Prefer to use @ref RleEncoding::array(), which generates this data at compile time.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided pointers point to valid run data in progmem.
+		/// It is thus possible to construct an invalid @ref RleArray,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		constexpr RleArray(const value_type * values, const uint8_t * lengths, const uint16_t * checkpoints, size_type run_count) :
+			values(values), lengths(lengths), checkpoints(checkpoints), runs(run_count)
+		{
+		}
+
+		/// @brief
+		/// Returns `true` if the array is empty, returns `false` otherwise.
+		///
+		/// @note
+		/// Always returns `false`, because an @ref RleArray cannot be empty.
+		constexpr bool empty() const noexcept
+		{
+			return (capacity == 0);
+		}
+
+		/// @brief
+		/// Returns the number of elements in the array.
+		constexpr size_type size() const noexcept
+		{
+			return capacity;
+		}
+
+		/// @brief
+		/// Returns the maximum number of elements in the array.
+		constexpr size_type max_size() const noexcept
+		{
+			return capacity;
+		}
+
+		/// @brief
+		/// Returns the number of runs used to encode the array.
+		constexpr size_type run_count() const noexcept
+		{
+			return this->runs;
+		}
+
+		/// @brief
+		/// Returns a copy of the first element of the array.
+		value_type front() const
+		{
+			return progmem::readProgmem(this->values[0]);
+		}
+
+		/// @brief
+		/// Returns a copy of the last element of the array.
+		value_type back() const
+		{
+			return progmem::readProgmem(this->values[this->runs - 1]);
+		}
+
+		/// @brief
+		/// Returns a copy of the element at the specified index.
+		///
+		/// @warning
+		/// This function does no bounds checking.
+		/// <em>Providing an `index` that is greater than or equal to
+		/// @slink{progmem::RleArray::size(),`array.size()`}
+		/// will result in a buffer overrun, which is <strong>undefined behaviour</strong></em>.
+		value_type operator[](size_type index) const
+		{
+			// Find the last checkpoint at or before the index
+			size_type lower = 0;
+			size_type upper = details::rle_checkpoint_count(this->runs);
+
+			while((upper - lower) > 1)
+			{
+				const size_type middle = (lower + ((upper - lower) / 2));
+
+				if(pgm_read_word(&this->checkpoints[middle]) <= index)
+					lower = middle;
+				else
+					upper = middle;
+			}
+
+			// Then scan the runs that follow it
+			size_type run = (lower * details::rle_checkpoint_interval);
+			size_type end = pgm_read_word(&this->checkpoints[lower]);
+
+			while(true)
+			{
+				end += pgm_read_byte(&this->lengths[run]);
+
+				if(index < end)
+					break;
+
+				++run;
+			}
+
+			return progmem::readProgmem(this->values[run]);
+		}
+
+		/// @brief
+		/// Returns a const iterator pointing to the first element of the array.
+		const_iterator begin() const
+		{
+			return const_iterator(this->values, this->lengths, 0);
+		}
+
+		/// @brief
+		/// Returns a const iterator pointing to the first element of the array.
+		const_iterator cbegin() const
+		{
+			return const_iterator(this->values, this->lengths, 0);
+		}
+
+		/// @brief
+		/// Returns a past-the-end const iterator pointing beyond the last element of the array.
+		///
+		/// @warning
+		/// Do not attempt to dereference the returned iterator.
+		/// <em>Doing so will result in <strong>undefined behaviour</strong></em>.
+		const_iterator end() const
+		{
+			return const_iterator(this->values, this->lengths, this->runs);
+		}
+
+		/// @brief
+		/// Returns a past-the-end const iterator pointing beyond the last element of the array.
+		///
+		/// @warning
+		/// Do not attempt to dereference the returned iterator.
+		/// <em>Doing so will result in <strong>undefined behaviour</strong></em>.
+		const_iterator cend() const
+		{
+			return const_iterator(this->values, this->lengths, this->runs);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint16_t, uint32_t
+#include <stdint.h>
+
+// For PROGMEM
+#include <avr/pgmspace.h>
+
+// For utils::MakeIndexSequence
+#include "../utils.h"
+
+#include "RleArray.h"
+#include "details/rle_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Run-length encodes an array at compile time,
+	/// storing the resulting runs in progmem.
+	///
+	/// @details
+	/// The source array is only read at compile time,
+	/// so it need not be stored in progmem,
+	/// and it will not occupy any space in the program
+	/// unless it is also used at runtime.
+	///
+	/// E.g.
+	/// ```
+	/// constexpr uint8_t level_source[] = { 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 2 };
+	///
+	/// using LevelEncoding = progmem::RleEncoding<uint8_t, 12, level_source>;
+	///
+	/// constexpr auto level = LevelEncoding::array();
+	///
+	/// uint8_t tile = level[5];
+	/// ```
+	///
+	/// @tparam Type
+	/// The element type, which must be comparable with `==` in a constant expression.
+	template<typename Type, size_t capacity, const Type (& source)[capacity]>
+	class RleEncoding
+	{
+		static_assert(capacity > 0, "RleEncoding requires at least one element");
+		static_assert(capacity <= 0xFFFF, "RleEncoding supports at most 65535 elements");
+
+	private:
+		using index_array = details::constant_array<uint32_t, capacity>;
+
+		// Compile-time intermediate tables.
+		// These are only read during compilation and are not referenced by the generated code.
+		static constexpr index_array changes = details::make_rle_changes(source, utils::MakeIndexSequence<capacity>());
+		static constexpr index_array change_counts = details::make_inclusive_sums(details::prefix_summer<capacity>::scan(changes, 0).values, changes.values, utils::MakeIndexSequence<capacity>());
+		static constexpr index_array starts = details::make_rle_starts(change_counts.values, utils::MakeIndexSequence<capacity>());
+		static constexpr index_array start_counts = details::make_inclusive_sums(details::prefix_summer<capacity>::scan(starts, 0).values, starts.values, utils::MakeIndexSequence<capacity>());
+
+	public:
+		/// @brief
+		/// The number of runs.
+		static constexpr size_t run_count = start_counts.values[capacity - 1];
+
+		/// @brief
+		/// The number of checkpoints.
+		static constexpr size_t checkpoint_count = details::rle_checkpoint_count(run_count);
+
+	private:
+		static constexpr details::constant_array<uint32_t, run_count> run_firsts = details::make_rle_run_firsts(start_counts.values, utils::MakeIndexSequence<run_count>());
+
+	public:
+		/// @brief
+		/// The value of each run.
+		static constexpr details::constant_array<Type, run_count> values PROGMEM = details::make_rle_values(source, run_firsts.values, utils::MakeIndexSequence<run_count>());
+
+		/// @brief
+		/// The length of each run, followed by a `0`.
+		static constexpr details::constant_array<uint8_t, run_count + 1> lengths PROGMEM = details::make_rle_lengths<capacity>(run_firsts.values, utils::MakeIndexSequence<run_count>());
+
+		/// @brief
+		/// The index of the first element of every 16th run.
+		static constexpr details::constant_array<uint16_t, checkpoint_count> checkpoints PROGMEM = details::make_rle_checkpoints(run_firsts.values, utils::MakeIndexSequence<checkpoint_count>());
+
+	public:
+		/// @brief
+		/// Returns an @ref RleArray that refers to the encoded runs.
+		static constexpr RleArray<Type, capacity> array()
+		{
+			return RleArray<Type, capacity>(&values.values[0], &lengths.values[0], &checkpoints.values[0], run_count);
+		}
+
+		/// @brief
+		/// Returns the number of bytes of progmem occupied by the encoding.
+		static constexpr size_t encoded_size()
+		{
+			return (sizeof(values) + sizeof(lengths) + sizeof(checkpoints));
+		}
+	};
+
+	// Definitions of the static data members, as required by C++11
+
+	template<typename Type, size_t capacity, const Type (& source)[capacity]>
+	constexpr typename RleEncoding<Type, capacity, source>::index_array RleEncoding<Type, capacity, source>::changes;
+
+	template<typename Type, size_t capacity, const Type (& source)[capacity]>
+	constexpr typename RleEncoding<Type, capacity, source>::index_array RleEncoding<Type, capacity, source>::change_counts;
+
+	template<typename Type, size_t capacity, const Type (& source)[capacity]>
+	constexpr typename RleEncoding<Type, capacity, source>::index_array RleEncoding<Type, capacity, source>::starts;
+
+	template<typename Type, size_t capacity, const Type (& source)[capacity]>
+	constexpr typename RleEncoding<Type, capacity, source>::index_array RleEncoding<Type, capacity, source>::start_counts;
+
+	template<typename Type, size_t capacity, const Type (& source)[capacity]>
+	constexpr details::constant_array<uint32_t, RleEncoding<Type, capacity, source>::run_count> RleEncoding<Type, capacity, source>::run_firsts;
+
+	template<typename Type, size_t capacity, const Type (& source)[capacity]>
+	constexpr details::constant_array<Type, RleEncoding<Type, capacity, source>::run_count> RleEncoding<Type, capacity, source>::values;
+
+	template<typename Type, size_t capacity, const Type (& source)[capacity]>
+	constexpr details::constant_array<uint8_t, RleEncoding<Type, capacity, source>::run_count + 1> RleEncoding<Type, capacity, source>::lengths;
+
+	template<typename Type, size_t capacity, const Type (& source)[capacity]>
+	constexpr details::constant_array<uint16_t, RleEncoding<Type, capacity, source>::checkpoint_count> RleEncoding<Type, capacity, source>::checkpoints;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+// For pgm_read_byte
+#include <avr/pgmspace.h>
+
+#include "readProgmem.h"
+
+namespace progmem
+{
+	/// @brief
+	/// A forward iterator over the elements of an @ref RleArray.
+	///
+	/// @details
+	/// The iterator tracks its position as a run and an offset within that run,
+	/// so advancing costs at most one progmem read
+	/// and dereferencing costs one progmem read.
+	template<typename Type>
+	class RleIterator
+	{
+	public:
+		/// @brief
+		/// The type of the elements.
+		using value_type = Type;
+
+		/// @brief
+		/// The unsigned integer type used to represent run indices.
+		using size_type = size_t;
+
+	private:
+		const value_type * values;
+		const uint8_t * lengths;
+		size_type run;
+		uint8_t offset;
+		uint8_t length;
+
+	public:
+		/// @brief
+		/// Constructs an iterator pointing to the first element of the specified run.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided pointers point to run data in progmem.
+		/// Providing anything else will result in <strong>undefined behaviour</strong>.
+		RleIterator(const value_type * values, const uint8_t * lengths, size_type run) :
+			values(values), lengths(lengths), run(run), offset(0), length(pgm_read_byte(&lengths[run]))
+		{
+		}
+
+		/// @brief
+		/// Returns a copy of the element that the iterator refers to.
+		value_type operator *() const
+		{
+			return progmem::readProgmem(this->values[this->run]);
+		}
+
+		RleIterator & operator ++()
+		{
+			++this->offset;
+
+			if(this->offset == this->length)
+			{
+				++this->run;
+				this->offset = 0;
+
+				// The lengths end with a zero, so this is valid for the last run
+				this->length = pgm_read_byte(&this->lengths[this->run]);
+			}
+
+			return *this;
+		}
+
+		RleIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+
+		friend bool operator ==(const RleIterator & left, const RleIterator & right)
+		{
+			return ((left.run == right.run) && (left.offset == right.offset));
+		}
+
+		friend bool operator !=(const RleIterator & left, const RleIterator & right)
+		{
+			return ((left.run != right.run) || (left.offset != right.offset));
+		}
+	};
+}
\ No newline at end of file
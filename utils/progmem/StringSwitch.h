@@ -0,0 +1,235 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint32_t
+#include <stdint.h>
+
+// For strlen
+#include <string.h>
+
+// For pgm_read_dword, pgm_read_ptr, pgm_read_byte, memcmp_P
+#include <avr/pgmspace.h>
+
+// For utils::fnv1a, utils::IndexSequence
+#include "../utils.h"
+
+#include "details/read_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// A single case of a @ref StringSwitch,
+	/// associating a string stored in progmem with a handler.
+	///
+	/// @details
+	/// Create entries with @ref makeStringSwitchEntry
+	/// so that the hash is computed at compile time.
+	template<typename Handler>
+	struct StringSwitchEntry
+	{
+		/// @brief
+		/// The type of the handler.
+		/// Typically a function pointer.
+		using handler_type = Handler;
+
+		/// @brief
+		/// The FNV-1a hash of @ref string.
+		uint32_t hash;
+
+		/// @brief
+		/// A pointer to a null-terminated string in progmem.
+		const char * string;
+
+		/// @brief
+		/// The handler associated with @ref string.
+		handler_type handler;
+	};
+
+	/// @brief
+	/// Creates a @ref StringSwitchEntry, hashing the string at compile time.
+	///
+	/// @details
+	/// The string must be a `constexpr` array so that it can be hashed at compile time,
+	/// e.g. `constexpr char command_move[] PROGMEM = "move";`.
+	template<typename Handler>
+	constexpr StringSwitchEntry<Handler> makeStringSwitchEntry(const char * string, Handler handler)
+	{
+		return { utils::fnv1a(string), string, handler };
+	}
+
+	/// @brief
+	/// A table of @sref{progmem::StringSwitchEntry,StringSwitchEntries} sorted by hash.
+	///
+	/// @details
+	/// Create tables with @ref makeStringSwitchTable,
+	/// and store them in progmem.
+	template<typename Handler, size_t size>
+	struct StringSwitchTable
+	{
+		/// @brief
+		/// The entries of the table, in ascending order of hash.
+		StringSwitchEntry<Handler> entries[size];
+	};
+
+	// Entities within the `details` namespace are
+	// not considered part of the API and should not
+	// be referenced from user code as anything within
+	// the `details` namespace may be removed or renamed
+	// without warning or deprecation.
+	namespace details
+	{
+		// Counts the entries that order before entries[index].
+		// Ties are broken by position, so every entry has a unique rank.
+		template<typename Handler, size_t size>
+		constexpr size_t string_switch_rank(const StringSwitchEntry<Handler> (& entries)[size], size_t index, size_t other = 0)
+		{
+			return (other == size) ? 0 :
+				(((entries[other].hash < entries[index].hash) || ((entries[other].hash == entries[index].hash) && (other < index))) ? 1 : 0) +
+				string_switch_rank(entries, index, other + 1);
+		}
+
+		// Finds the index of the entry with the specified rank.
+		template<typename Handler, size_t size>
+		constexpr size_t string_switch_select(const StringSwitchEntry<Handler> (& entries)[size], size_t rank, size_t index = 0)
+		{
+			return (string_switch_rank(entries, index) == rank) ? index : string_switch_select(entries, rank, index + 1);
+		}
+
+		template<typename Handler, size_t size, size_t ... indices>
+		constexpr StringSwitchTable<Handler, size> sort_string_switch(const StringSwitchEntry<Handler> (& entries)[size], utils::IndexSequence<indices...>)
+		{
+			return { { entries[string_switch_select(entries, indices)]... } };
+		}
+	}
+
+	/// @brief
+	/// Creates a @ref StringSwitchTable by sorting the provided entries by hash at compile time.
+	///
+	/// @details
+	/// The result should be stored in progmem, e.g.
+	/// `constexpr auto table PROGMEM = progmem::makeStringSwitchTable(entries);`
+	///
+	/// @note
+	/// Sorting is `O(n³)` at compile time, which is fine for tables of
+	/// a few dozen entries, but may exceed the compiler's limits for much larger tables.
+	template<typename Handler, size_t size>
+	constexpr StringSwitchTable<Handler, size> makeStringSwitchTable(const StringSwitchEntry<Handler> (& entries)[size])
+	{
+		return details::sort_string_switch(entries, utils::MakeIndexSequence<size>());
+	}
+
+	/// @brief
+	/// Maps strings in RAM to handlers using a @ref StringSwitchTable stored in progmem.
+	///
+	/// @details
+	/// Lookup hashes the string once, binary searches the table by hash,
+	/// and then confirms the match with a single `memcmp_P`.
+	/// This makes lookup `O(log n + length)` rather than the `O(n * length)`
+	/// of comparing against every string in turn.
+	template<typename Handler>
+	class StringSwitch
+	{
+	public:
+		/// @brief
+		/// The type of the handlers.
+		using handler_type = Handler;
+
+		/// @brief
+		/// The type of the table entries.
+		using entry_type = StringSwitchEntry<handler_type>;
+
+		/// @brief
+		/// The unsigned integer type used for measuring the size of the table.
+		using size_type = size_t;
+
+	private:
+		const entry_type * entries;
+		size_type entry_count;
+
+	private:
+		size_type lower_bound(uint32_t hash) const
+		{
+			size_type low = 0;
+			size_type high = this->entry_count;
+
+			while(low < high)
+			{
+				const size_type middle = (low + ((high - low) / 2));
+
+				if(pgm_read_dword(&this->entries[middle].hash) < hash)
+					low = (middle + 1);
+				else
+					high = middle;
+			}
+
+			return low;
+		}
+
+	public:
+		/// @brief
+		/// Constructs a @ref StringSwitch that uses the provided table.
+		///
+		/// @warning
+		/// There is no way of verifying that the provided reference refers to a table in progmem.
+		/// It is thus possible to construct an invalid @ref StringSwitch,
+		/// which can lead to <strong>undefined behaviour</strong>.
+		template<size_t size>
+		constexpr StringSwitch(const StringSwitchTable<handler_type, size> & table) :
+			entries(&table.entries[0]), entry_count(size)
+		{
+		}
+
+		/// @brief
+		/// Returns the number of entries in the table.
+		constexpr size_type size() const noexcept
+		{
+			return this->entry_count;
+		}
+
+		/// @brief
+		/// Finds the handler associated with the first `size` characters of `string`.
+		/// Returns `fallback` if there is no such handler.
+		///
+		/// @details
+		/// `string` need not be null-terminated,
+		/// so tokens can be looked up directly within a larger buffer.
+		handler_type find(const char * string, size_type size, handler_type fallback) const
+		{
+			const uint32_t hash = utils::fnv1a(string, size);
+
+			for(size_type index = this->lower_bound(hash); index < this->entry_count; ++index)
+			{
+				const auto & entry = this->entries[index];
+
+				if(pgm_read_dword(&entry.hash) != hash)
+					break;
+
+				const auto entry_string = static_cast<const char *>(pgm_read_ptr(&entry.string));
+
+				if((memcmp_P(string, entry_string, size) == 0) && (pgm_read_byte(&entry_string[size]) == '\0'))
+					return details::read_progmem_helper<handler_type>::read_progmem(entry.handler);
+			}
+
+			return fallback;
+		}
+
+		/// @brief
+		/// Finds the handler associated with the null-terminated string `string`.
+		/// Returns `fallback` if there is no such handler.
+		handler_type find(const char * string, handler_type fallback) const
+		{
+			return this->find(string, strlen(string), fallback);
+		}
+	};
+
+	/// @brief
+	/// A simpler way to construct a @ref StringSwitch.
+	/// This function allows the handler type to be inferred.
+	template<typename Handler, size_t size>
+	constexpr StringSwitch<Handler> makeStringSwitch(const StringSwitchTable<Handler, size> & table)
+	{
+		return StringSwitch<Handler>(table);
+	}
+}
\ No newline at end of file
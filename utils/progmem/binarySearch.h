@@ -0,0 +1,78 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+#include "ProgmemPointer.h"
+#include "ProgmemArray.h"
+#include "details/search_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Returns `true` if [`first`, `last`) contains an element equivalent to `key`, otherwise returns `false`.
+	///
+	/// @details
+	/// Two values are considered equivalent if neither is less than the other.
+	///
+	/// Ranges of more than 256 elements are searched with a fixed number of probes
+	/// and no data-dependent branches.
+	///
+	/// @warning
+	/// The range must be sorted in ascending order of key,
+	/// otherwise the result is unspecified.
+	template<typename Type, typename Key>
+	bool binarySearch(ProgmemPointer<Type> first, ProgmemPointer<Type> last, const Key & key)
+	{
+		return details::binary_search(first, last, key, details::element_key<Type>());
+	}
+
+	/// @brief
+	/// Returns `true` if [`first`, `last`) contains an element whose `member` is equivalent to `key`, otherwise returns `false`.
+	///
+	/// @details
+	/// Only the `member` of each probed element is read from progmem,
+	/// rather than the whole element.
+	///
+	/// E.g.
+	/// ```
+	/// auto result = progmem::binarySearch(items.begin(), items.end(), id, &Item::id);
+	/// ```
+	///
+	/// @warning
+	/// The range must be sorted in ascending order of key,
+	/// otherwise the result is unspecified.
+	template<typename Type, typename Key, typename Member, typename Class>
+	bool binarySearch(ProgmemPointer<Type> first, ProgmemPointer<Type> last, const Key & key, Member Class::* member)
+	{
+		return details::binary_search(first, last, key, details::member_key<Member, Class> { member });
+	}
+
+	/// @brief
+	/// Returns `true` if `array` contains an element equivalent to `key`, otherwise returns `false`.
+	///
+	/// @warning
+	/// The range must be sorted in ascending order of key,
+	/// otherwise the result is unspecified.
+	template<typename Type, size_t capacity, typename Key>
+	bool binarySearch(const ProgmemArray<Type, capacity> & array, const Key & key)
+	{
+		return binarySearch(array.begin(), array.end(), key);
+	}
+
+	/// @brief
+	/// Returns `true` if `array` contains an element whose `member` is equivalent to `key`, otherwise returns `false`.
+	///
+	/// @details
+	/// Only the `member` of each probed element is read from progmem,
+	/// rather than the whole element.
+	///
+	/// @warning
+	/// The range must be sorted in ascending order of key,
+	/// otherwise the result is unspecified.
+	template<typename Type, size_t capacity, typename Key, typename Member, typename Class>
+	bool binarySearch(const ProgmemArray<Type, capacity> & array, const Key & key, Member Class::* member)
+	{
+		return binarySearch(array.begin(), array.end(), key, member);
+	}
+}
\ No newline at end of file
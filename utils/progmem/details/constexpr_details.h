@@ -0,0 +1,178 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint32_t
+#include <stdint.h>
+
+// For utils::IndexSequence, utils::MakeIndexSequence
+#include "../../utils.h"
+
+// Compile-time array algorithms, used to build progmem tables.
+//
+// All of these divide and conquer, so that the recursion depth
+// stays within the compiler's constexpr depth limit for large arrays,
+// and so that the total work is O(n log² n) rather than O(n²),
+// which would exceed the compiler's constexpr operation limit.
+
+namespace progmem
+{
+	namespace details
+	{
+		// A plain aggregate array, usable as the result of a constexpr function.
+		// (utils::Array can't be used because its elements are private.)
+		template<typename Type, size_t size>
+		struct constant_array
+		{
+			Type values[size];
+		};
+
+		constexpr size_t middle_index(size_t begin, size_t end)
+		{
+			return (begin + ((end - begin) / 2));
+		}
+
+		constexpr uint32_t max_of(uint32_t left, uint32_t right)
+		{
+			return (left > right) ? left : right;
+		}
+
+		// Sums the elements of values[begin, end)
+		template<size_t size>
+		constexpr uint32_t sum_values(const uint32_t (& values)[size], size_t begin, size_t end)
+		{
+			return ((end - begin) == 0) ? 0 :
+				((end - begin) == 1) ? values[begin] :
+				(sum_values(values, begin, middle_index(begin, end)) + sum_values(values, middle_index(begin, end), end));
+		}
+
+		// Returns the largest element of values[begin, end), or 0 if the range is empty
+		template<size_t size>
+		constexpr uint32_t max_value(const uint32_t (& values)[size], size_t begin, size_t end)
+		{
+			return ((end - begin) == 0) ? 0 :
+				((end - begin) == 1) ? values[begin] :
+				max_of(max_value(values, begin, middle_index(begin, end)), max_value(values, middle_index(begin, end), end));
+		}
+
+		// Returns the first index in [begin, end) whose element is not less than 'value',
+		// or 'end' if there is no such element, assuming values[begin, end) is sorted
+		template<size_t size>
+		constexpr size_t lower_bound(const uint32_t (& values)[size], size_t begin, size_t end, uint32_t value)
+		{
+			return (begin == end) ? begin :
+				(values[middle_index(begin, end)] < value) ?
+					lower_bound(values, middle_index(begin, end) + 1, end, value) :
+					lower_bound(values, begin, middle_index(begin, end), value);
+		}
+
+		// Returns the last index in [begin, end) whose element is not greater than 'value',
+		// assuming values[begin, end) is sorted and values[begin] <= value
+		template<size_t size>
+		constexpr size_t find_last_not_greater(const uint32_t (& values)[size], size_t begin, size_t end, uint32_t value)
+		{
+			return ((end - begin) <= 1) ? begin :
+				(values[middle_index(begin, end)] <= value) ?
+					find_last_not_greater(values, middle_index(begin, end), end, value) :
+					find_last_not_greater(values, begin, middle_index(begin, end), value);
+		}
+
+		// Copies values[offset, offset + count)
+		template<size_t size, size_t ... indices>
+		constexpr constant_array<uint32_t, sizeof...(indices)> slice(const constant_array<uint32_t, size> & values, size_t offset, utils::IndexSequence<indices...>)
+		{
+			return { { values.values[offset + indices]... } };
+		}
+
+		// Joins two arrays end to end
+		template<size_t left_size, size_t right_size, size_t ... indices>
+		constexpr constant_array<uint32_t, sizeof...(indices)> concatenate(const constant_array<uint32_t, left_size> & left, const constant_array<uint32_t, right_size> & right, utils::IndexSequence<indices...>)
+		{
+			return { { ((indices < left_size) ? left.values[indices] : right.values[indices - left_size])... } };
+		}
+
+		// Counts the elements of the sorted array 'left' that
+		// belong before 'position' when merged with the sorted array 'right'.
+		// (left[index] belongs at 'index + lower_bound(right, left[index])',
+		// which increases with 'index', so it can be binary searched.)
+		template<size_t left_size, size_t right_size>
+		constexpr size_t merge_count_before(const uint32_t (& left)[left_size], const uint32_t (& right)[right_size], size_t begin, size_t end, size_t position)
+		{
+			return (begin == end) ? begin :
+				((middle_index(begin, end) + lower_bound(right, 0, right_size, left[middle_index(begin, end)])) < position) ?
+					merge_count_before(left, right, middle_index(begin, end) + 1, end, position) :
+					merge_count_before(left, right, begin, middle_index(begin, end), position);
+		}
+
+		// Returns the element at 'position' in the merge of two sorted arrays,
+		// given the number of elements of 'left' that precede it
+		template<size_t left_size, size_t right_size>
+		constexpr uint32_t merge_select(const uint32_t (& left)[left_size], const uint32_t (& right)[right_size], size_t position, size_t count)
+		{
+			return ((count < left_size) && ((count + lower_bound(right, 0, right_size, left[count])) == position)) ?
+				left[count] :
+				right[position - count];
+		}
+
+		template<size_t left_size, size_t right_size, size_t ... indices>
+		constexpr constant_array<uint32_t, sizeof...(indices)> merge(const constant_array<uint32_t, left_size> & left, const constant_array<uint32_t, right_size> & right, utils::IndexSequence<indices...>)
+		{
+			return { { merge_select(left.values, right.values, indices, merge_count_before(left.values, right.values, 0, left_size, indices))... } };
+		}
+
+		// A merge sort of unique values
+		template<size_t size>
+		struct sorter
+		{
+			static constexpr size_t left_size = (size / 2);
+			static constexpr size_t right_size = (size - left_size);
+
+			static constexpr constant_array<uint32_t, size> sort(const constant_array<uint32_t, size> & values)
+			{
+				return merge
+				(
+					sorter<left_size>::sort(slice(values, 0, utils::MakeIndexSequence<left_size>())),
+					sorter<right_size>::sort(slice(values, left_size, utils::MakeIndexSequence<right_size>())),
+					utils::MakeIndexSequence<size>()
+				);
+			}
+		};
+
+		template<>
+		struct sorter<1>
+		{
+			static constexpr constant_array<uint32_t, 1> sort(const constant_array<uint32_t, 1> & values)
+			{
+				return values;
+			}
+		};
+
+		// Computes the exclusive prefix sums of an array, starting from 'initial'
+		template<size_t size>
+		struct prefix_summer
+		{
+			static constexpr size_t left_size = (size / 2);
+			static constexpr size_t right_size = (size - left_size);
+
+			static constexpr constant_array<uint32_t, size> scan(const constant_array<uint32_t, size> & values, uint32_t initial)
+			{
+				return concatenate
+				(
+					prefix_summer<left_size>::scan(slice(values, 0, utils::MakeIndexSequence<left_size>()), initial),
+					prefix_summer<right_size>::scan(slice(values, left_size, utils::MakeIndexSequence<right_size>()), initial + sum_values(values.values, 0, left_size)),
+					utils::MakeIndexSequence<size>()
+				);
+			}
+		};
+
+		template<>
+		struct prefix_summer<1>
+		{
+			static constexpr constant_array<uint32_t, 1> scan(const constant_array<uint32_t, 1> &, uint32_t initial)
+			{
+				return { { initial } };
+			}
+		};
+	}
+}
\ No newline at end of file
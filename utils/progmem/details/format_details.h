@@ -0,0 +1,441 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, int32_t, uint32_t
+#include <stdint.h>
+
+// For strlen
+#include <string.h>
+
+// For pgm_read_byte, strlen_P
+#include <avr/pgmspace.h>
+
+// For Print
+#include <Print.h>
+
+#include "../ProgmemString.h"
+
+namespace progmem
+{
+	namespace details
+	{
+		// The parsed contents of a placeholder
+		struct format_specification
+		{
+			uint8_t width;
+			uint8_t precision;
+			bool has_precision;
+			bool left_align;
+			bool zero_pad;
+			bool hexadecimal;
+			bool upper_case;
+		};
+
+		// A type-erased argument, so that the formatting code
+		// is compiled once rather than once per combination of argument types.
+		//
+		// There is deliberately no constructor for floating point or 64-bit types,
+		// so passing one is a compile error rather than a silent conversion.
+		class format_argument
+		{
+		public:
+			enum class kind : uint8_t
+			{
+				none,
+				character,
+				signed_integer,
+				unsigned_integer,
+				string,
+				progmem_string,
+			};
+
+		private:
+			kind argument_kind;
+			size_t size;
+
+			union
+			{
+				char character;
+				int32_t signed_integer;
+				uint32_t unsigned_integer;
+				const char * string;
+			};
+
+		public:
+			constexpr format_argument() :
+				argument_kind(kind::none), size(0), unsigned_integer(0)
+			{
+			}
+
+			constexpr format_argument(char value) :
+				argument_kind(kind::character), size(0), character(value)
+			{
+			}
+
+			constexpr format_argument(signed char value) :
+				argument_kind(kind::signed_integer), size(0), signed_integer(value)
+			{
+			}
+
+			constexpr format_argument(short value) :
+				argument_kind(kind::signed_integer), size(0), signed_integer(value)
+			{
+			}
+
+			constexpr format_argument(int value) :
+				argument_kind(kind::signed_integer), size(0), signed_integer(value)
+			{
+			}
+
+			constexpr format_argument(long value) :
+				argument_kind(kind::signed_integer), size(0), signed_integer(value)
+			{
+			}
+
+			constexpr format_argument(unsigned char value) :
+				argument_kind(kind::unsigned_integer), size(0), unsigned_integer(value)
+			{
+			}
+
+			constexpr format_argument(unsigned short value) :
+				argument_kind(kind::unsigned_integer), size(0), unsigned_integer(value)
+			{
+			}
+
+			constexpr format_argument(unsigned int value) :
+				argument_kind(kind::unsigned_integer), size(0), unsigned_integer(value)
+			{
+			}
+
+			constexpr format_argument(unsigned long value) :
+				argument_kind(kind::unsigned_integer), size(0), unsigned_integer(value)
+			{
+			}
+
+			constexpr format_argument(const char * value) :
+				argument_kind(kind::string), size(0), string(value)
+			{
+			}
+
+			format_argument(const ProgmemString & value) :
+				argument_kind(kind::progmem_string), size(value.length()), string(static_cast<const char *>(value))
+			{
+			}
+
+			format_argument(const __FlashStringHelper * value) :
+				argument_kind(kind::progmem_string), size(ProgmemString::npos), string(reinterpret_cast<const char *>(value))
+			{
+			}
+
+			size_t write(Print & output, const format_specification & specification) const;
+		};
+
+		constexpr uint8_t maximum_decimal_places = 9;
+
+		inline size_t write_repeated(Print & output, char character, uint8_t count)
+		{
+			for(uint8_t index = 0; index < count; ++index)
+				output.write(static_cast<uint8_t>(character));
+
+			return count;
+		}
+
+		inline uint8_t padding_for(const format_specification & specification, size_t length)
+		{
+			return (specification.width > length) ? static_cast<uint8_t>(specification.width - length) : 0;
+		}
+
+		inline uint8_t count_decimal_digits(uint32_t value)
+		{
+			uint8_t count = 1;
+
+			while(value >= 10)
+			{
+				value /= 10;
+				++count;
+			}
+
+			return count;
+		}
+
+		inline uint8_t count_hexadecimal_digits(uint32_t value)
+		{
+			uint8_t count = 1;
+
+			while(value >= 16)
+			{
+				value >>= 4;
+				++count;
+			}
+
+			return count;
+		}
+
+		inline uint32_t power_of_ten(uint8_t exponent)
+		{
+			uint32_t result = 1;
+
+			for(uint8_t index = 0; index < exponent; ++index)
+				result *= 10;
+
+			return result;
+		}
+
+		// Writes exactly 'digits' decimal digits, most significant first,
+		// without first converting the whole number into a buffer
+		inline void write_decimal_digits(Print & output, uint32_t value, uint8_t digits)
+		{
+			for(uint32_t divisor = power_of_ten(digits - 1); divisor > 0; divisor /= 10)
+			{
+				const uint32_t digit = (value / divisor);
+				output.write(static_cast<uint8_t>('0' + digit));
+				value -= (digit * divisor);
+			}
+		}
+
+		inline void write_hexadecimal_digits(Print & output, uint32_t value, uint8_t digits, bool upper_case)
+		{
+			const char ten = (upper_case ? 'A' : 'a');
+
+			for(uint8_t index = digits; index > 0; --index)
+			{
+				const uint8_t digit = static_cast<uint8_t>((value >> ((index - 1) * 4)) & 0x0F);
+				output.write(static_cast<uint8_t>((digit < 10) ? ('0' + digit) : (ten + (digit - 10))));
+			}
+		}
+
+		// Writes the body of a number, surrounded by the padding the specification asks for
+		inline size_t write_number(Print & output, const format_specification & specification, uint32_t magnitude, bool negative)
+		{
+			const uint8_t places = specification.has_precision ?
+				((specification.precision < maximum_decimal_places) ? specification.precision : maximum_decimal_places) :
+				0;
+
+			const bool fixed = (!specification.hexadecimal && (places > 0));
+
+			const uint32_t scale = fixed ? power_of_ten(places) : 1;
+			const uint32_t whole = (magnitude / scale);
+
+			const uint8_t digits = specification.hexadecimal ?
+				count_hexadecimal_digits(magnitude) :
+				count_decimal_digits(whole);
+
+			const size_t length = (negative ? 1 : 0) + digits + (fixed ? (1 + places) : 0);
+			const uint8_t padding = padding_for(specification, length);
+
+			if(!specification.left_align && !specification.zero_pad)
+				write_repeated(output, ' ', padding);
+
+			if(negative)
+				output.write(static_cast<uint8_t>('-'));
+
+			if(!specification.left_align && specification.zero_pad)
+				write_repeated(output, '0', padding);
+
+			if(specification.hexadecimal)
+			{
+				write_hexadecimal_digits(output, magnitude, digits, specification.upper_case);
+			}
+			else
+			{
+				write_decimal_digits(output, whole, digits);
+
+				if(fixed)
+				{
+					output.write(static_cast<uint8_t>('.'));
+					write_decimal_digits(output, (magnitude - (whole * scale)), places);
+				}
+			}
+
+			if(specification.left_align)
+				write_repeated(output, ' ', padding);
+
+			return (length + padding);
+		}
+
+		// Writes 'length' characters read by 'read', surrounded by padding
+		template<typename Reader>
+		size_t write_text(Print & output, const format_specification & specification, const char * text, size_t length, Reader read)
+		{
+			if(specification.has_precision && (specification.precision < length))
+				length = specification.precision;
+
+			const uint8_t padding = padding_for(specification, length);
+
+			if(!specification.left_align)
+				write_repeated(output, ' ', padding);
+
+			for(size_t index = 0; index < length; ++index)
+				output.write(static_cast<uint8_t>(read(&text[index])));
+
+			if(specification.left_align)
+				write_repeated(output, ' ', padding);
+
+			return (length + padding);
+		}
+
+		struct read_ram
+		{
+			char operator()(const char * pointer) const
+			{
+				return *pointer;
+			}
+		};
+
+		struct read_flash
+		{
+			char operator()(const char * pointer) const
+			{
+				return static_cast<char>(pgm_read_byte(pointer));
+			}
+		};
+
+		inline size_t format_argument::write(Print & output, const format_specification & specification) const
+		{
+			switch(this->argument_kind)
+			{
+				case kind::character:
+					return write_text(output, specification, &this->character, 1, read_ram());
+
+				case kind::signed_integer:
+				{
+					const bool negative = (this->signed_integer < 0);
+
+					// Negating as unsigned avoids overflow for the most negative value
+					const uint32_t magnitude = negative ?
+						(0 - static_cast<uint32_t>(this->signed_integer)) :
+						static_cast<uint32_t>(this->signed_integer);
+
+					return write_number(output, specification, magnitude, negative);
+				}
+
+				case kind::unsigned_integer:
+					return write_number(output, specification, this->unsigned_integer, false);
+
+				case kind::string:
+					return (this->string != nullptr) ?
+						write_text(output, specification, this->string, strlen(this->string), read_ram()) :
+						0;
+
+				case kind::progmem_string:
+					return (this->string != nullptr) ?
+						write_text(output, specification, this->string, (this->size != ProgmemString::npos) ? this->size : strlen_P(this->string), read_flash()) :
+						0;
+
+				default:
+					return 0;
+			}
+		}
+
+		inline uint8_t read_format_character(const char * format, size_t index, size_t size)
+		{
+			return (index < size) ? pgm_read_byte(&format[index]) : '\0';
+		}
+
+		// Parses the specification between ':' and '}',
+		// returning the index of the character after the closing brace
+		inline size_t parse_format_specification(const char * format, size_t index, size_t size, format_specification & specification)
+		{
+			specification = format_specification { 0, 0, false, false, false, false, false };
+
+			uint8_t character = read_format_character(format, index, size);
+
+			if(character == ':')
+			{
+				character = read_format_character(format, ++index, size);
+
+				if(character == '<')
+				{
+					specification.left_align = true;
+					character = read_format_character(format, ++index, size);
+				}
+
+				if(character == '0')
+				{
+					specification.zero_pad = true;
+					character = read_format_character(format, ++index, size);
+				}
+
+				while((character >= '0') && (character <= '9'))
+				{
+					specification.width = static_cast<uint8_t>((specification.width * 10) + (character - '0'));
+					character = read_format_character(format, ++index, size);
+				}
+
+				if(character == '.')
+				{
+					specification.has_precision = true;
+					character = read_format_character(format, ++index, size);
+
+					while((character >= '0') && (character <= '9'))
+					{
+						specification.precision = static_cast<uint8_t>((specification.precision * 10) + (character - '0'));
+						character = read_format_character(format, ++index, size);
+					}
+				}
+
+				if((character == 'x') || (character == 'X'))
+				{
+					specification.hexadecimal = true;
+					specification.upper_case = (character == 'X');
+					character = read_format_character(format, ++index, size);
+				}
+			}
+
+			// Skip anything unrecognised, up to and including the closing brace
+			while((character != '}') && (character != '\0'))
+				character = read_format_character(format, ++index, size);
+
+			return (character == '}') ? (index + 1) : index;
+		}
+
+		// Writes a format string stored in progmem, substituting the arguments in order.
+		// Reading stops at 'size' characters or at a null character, whichever comes first.
+		inline size_t format_progmem(Print & output, const char * format, size_t size, const format_argument * arguments, uint8_t count)
+		{
+			size_t written = 0;
+			uint8_t next = 0;
+
+			for(size_t index = 0; index < size;)
+			{
+				const uint8_t character = pgm_read_byte(&format[index]);
+
+				if(character == '\0')
+					break;
+
+				const uint8_t following = read_format_character(format, index + 1, size);
+
+				// '{{' and '}}' are literal braces
+				if(((character == '{') || (character == '}')) && (following == character))
+				{
+					output.write(character);
+					++written;
+					index += 2;
+					continue;
+				}
+
+				if(character != '{')
+				{
+					output.write(character);
+					++written;
+					++index;
+					continue;
+				}
+
+				format_specification specification;
+				index = parse_format_specification(format, index + 1, size, specification);
+
+				// Placeholders without a matching argument produce nothing
+				if(next < count)
+				{
+					written += arguments[next].write(output, specification);
+					++next;
+				}
+			}
+
+			return written;
+		}
+	}
+}
\ No newline at end of file
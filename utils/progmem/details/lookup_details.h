@@ -0,0 +1,51 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, int32_t, int64_t
+#include <stdint.h>
+
+// For utils::IndexSequence
+#include "../../utils.h"
+
+#include "constexpr_details.h"
+
+namespace progmem
+{
+	namespace details
+	{
+		// Calls 'generator' with each index in turn
+		template<typename Type, typename Generator, size_t ... indices>
+		constexpr constant_array<Type, sizeof...(indices)> make_lookup_table(const Generator & generator, utils::IndexSequence<indices...>)
+		{
+			return { { static_cast<Type>(generator(indices))... } };
+		}
+
+		// The signed type used for the product of a difference between two 'Type' values
+		// and a fraction of 'fraction_bits' bits.
+		// The difference is less than 2 to the power of the bits in 'Type' in magnitude,
+		// so int32_t suffices while the bits of both sum to no more than 31.
+		template<typename Type, uint8_t fraction_bits, bool fits = (((sizeof(Type) * 8) + fraction_bits) <= 31)>
+		struct interpolation_intermediate
+		{
+			using type = int32_t;
+		};
+
+		template<typename Type, uint8_t fraction_bits>
+		struct interpolation_intermediate<Type, fraction_bits, false>
+		{
+			using type = int64_t;
+		};
+
+		// Interpolates between 'left' and 'right' by 'fraction / (1 << fraction_bits)'
+		template<uint8_t fraction_bits, typename Type>
+		Type interpolate_linear(Type left, Type right, uint32_t fraction)
+		{
+			using intermediate = typename interpolation_intermediate<Type, fraction_bits>::type;
+
+			const intermediate difference = (static_cast<intermediate>(right) - static_cast<intermediate>(left));
+			return static_cast<Type>(static_cast<intermediate>(left) + ((difference * static_cast<intermediate>(fraction)) >> fraction_bits));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint16_t, uint32_t
+#include <stdint.h>
+
+// For utils::IndexSequence
+#include "../../utils.h"
+
+#include "constexpr_details.h"
+
+namespace progmem
+{
+	namespace details
+	{
+		//
+		// Hashing
+		//
+
+		constexpr uint32_t perfect_hash_round(uint32_t value)
+		{
+			return ((value ^ (value >> 16)) * 0x45D9F3Bu);
+		}
+
+		constexpr uint32_t perfect_hash_finish(uint32_t value)
+		{
+			return (value ^ (value >> 16));
+		}
+
+		constexpr uint32_t perfect_hash_mix(uint32_t key, uint32_t seed)
+		{
+			return perfect_hash_finish(perfect_hash_round(perfect_hash_round(key ^ (seed * 0x9E3779B9u))));
+		}
+
+		// Maps a hash onto [0, range) with a multiply and a shift,
+		// avoiding a slow 32-bit division on AVR
+		constexpr size_t perfect_hash_reduce(uint32_t hash, size_t range)
+		{
+			return static_cast<size_t>(((hash >> 16) * static_cast<uint32_t>(range)) >> 16);
+		}
+
+		template<typename Key>
+		constexpr size_t perfect_hash_bucket(Key key, size_t bucket_count)
+		{
+			return perfect_hash_reduce(perfect_hash_mix(static_cast<uint32_t>(key), 0), bucket_count);
+		}
+
+		template<typename Key>
+		constexpr size_t perfect_hash_slot(Key key, size_t seed, size_t slot_count)
+		{
+			return perfect_hash_reduce(perfect_hash_mix(static_cast<uint32_t>(key), static_cast<uint32_t>(seed + 1)), slot_count);
+		}
+
+		//
+		// Table construction.
+		// Each step produces one intermediate array,
+		// so that each step is a separate constant expression.
+		//
+		// The keys are grouped by bucket by sorting 'bucket * key_count + index',
+		// from which both the bucket and the index of each key can be recovered.
+		//
+
+		// The descriptor stored in progmem for each bucket
+		struct perfect_hash_bucket_entry
+		{
+			// The index of the bucket's first slot
+			uint16_t offset;
+
+			// The seed that maps the bucket's keys to distinct slots
+			uint8_t seed;
+
+			// The number of slots belonging to the bucket
+			uint8_t size;
+		};
+
+		// The value stored in an empty slot
+		constexpr uint16_t perfect_hash_empty_slot = 0xFFFF;
+
+		// The first seed that is not valid, used to indicate that no seed was found
+		constexpr uint32_t perfect_hash_seed_limit = 256;
+
+		// 'bucket * key_count + index' for each key
+		template<typename Key, size_t key_count, size_t ... indices>
+		constexpr constant_array<uint32_t, key_count> make_bucket_keys(const Key (& keys)[key_count], size_t bucket_count, utils::IndexSequence<indices...>)
+		{
+			return { { static_cast<uint32_t>((perfect_hash_bucket(keys[indices], bucket_count) * static_cast<uint32_t>(key_count)) + indices)... } };
+		}
+
+		// The index of the first key of each bucket, once sorted
+		template<size_t key_count, size_t ... indices>
+		constexpr constant_array<uint32_t, sizeof...(indices)> make_bucket_firsts(const uint32_t (& sorted)[key_count], utils::IndexSequence<indices...>)
+		{
+			return { { static_cast<uint32_t>(lower_bound(sorted, 0, key_count, static_cast<uint32_t>(indices * key_count)))... } };
+		}
+
+		// The number of keys in each bucket
+		template<size_t key_count, size_t ... indices>
+		constexpr constant_array<uint32_t, sizeof...(indices)> make_bucket_sizes(const uint32_t (& sorted)[key_count], utils::IndexSequence<indices...>)
+		{
+			return { { static_cast<uint32_t>(lower_bound(sorted, 0, key_count, static_cast<uint32_t>((indices + 1) * key_count)) - lower_bound(sorted, 0, key_count, static_cast<uint32_t>(indices * key_count)))... } };
+		}
+
+		// The number of slots in each bucket
+		template<size_t bucket_count, size_t ... indices>
+		constexpr constant_array<uint32_t, bucket_count> make_bucket_slot_counts(const uint32_t (& bucket_sizes)[bucket_count], utils::IndexSequence<indices...>)
+		{
+			return { { (bucket_sizes[indices] * bucket_sizes[indices])... } };
+		}
+
+		// Returns the key at 'position' once sorted
+		template<typename Key, size_t key_count>
+		constexpr Key perfect_hash_sorted_key(const Key (& keys)[key_count], const uint32_t (& sorted)[key_count], size_t position)
+		{
+			return keys[sorted[position] % key_count];
+		}
+
+		// Returns true if no two of the 'count' keys from sorted[first] onwards
+		// map to the same slot, by testing each pair (left, right) in turn
+		template<typename Key, size_t key_count>
+		constexpr bool perfect_hash_slots_distinct(const Key (& keys)[key_count], const uint32_t (& sorted)[key_count], size_t first, size_t count, uint32_t seed, size_t left, size_t right)
+		{
+			return (right == count) ?
+				(((left + 2) >= count) ? true : perfect_hash_slots_distinct(keys, sorted, first, count, seed, left + 1, left + 2)) :
+				((perfect_hash_slot(perfect_hash_sorted_key(keys, sorted, first + left), seed, count * count) != perfect_hash_slot(perfect_hash_sorted_key(keys, sorted, first + right), seed, count * count)) &&
+				perfect_hash_slots_distinct(keys, sorted, first, count, seed, left, right + 1));
+		}
+
+		// Returns the first seed that maps the bucket's keys to distinct slots,
+		// or perfect_hash_seed_limit if there is no such seed
+		template<typename Key, size_t key_count>
+		constexpr uint32_t perfect_hash_find_seed(const Key (& keys)[key_count], const uint32_t (& sorted)[key_count], size_t first, size_t count, uint32_t seed)
+		{
+			return (count < 2) ? 0 :
+				(seed >= perfect_hash_seed_limit) ? perfect_hash_seed_limit :
+				perfect_hash_slots_distinct(keys, sorted, first, count, seed, 0, 1) ? seed :
+				perfect_hash_find_seed(keys, sorted, first, count, seed + 1);
+		}
+
+		// The seed of each bucket
+		template<typename Key, size_t key_count, size_t bucket_count, size_t ... indices>
+		constexpr constant_array<uint32_t, bucket_count> make_bucket_seeds(const Key (& keys)[key_count], const uint32_t (& sorted)[key_count], const uint32_t (& bucket_firsts)[bucket_count], const uint32_t (& bucket_sizes)[bucket_count], utils::IndexSequence<indices...>)
+		{
+			return { { perfect_hash_find_seed(keys, sorted, bucket_firsts[indices], bucket_sizes[indices], 0)... } };
+		}
+
+		// Returns the index of the key that occupies 'slot' within its bucket,
+		// or perfect_hash_empty_slot if no key does
+		template<typename Key, size_t key_count>
+		constexpr uint16_t perfect_hash_slot_key(const Key (& keys)[key_count], const uint32_t (& sorted)[key_count], size_t first, size_t count, uint32_t seed, size_t slot, size_t member)
+		{
+			return (member == count) ? perfect_hash_empty_slot :
+				(perfect_hash_slot(perfect_hash_sorted_key(keys, sorted, first + member), seed, count * count) == slot) ? static_cast<uint16_t>(sorted[first + member] % key_count) :
+				perfect_hash_slot_key(keys, sorted, first, count, seed, slot, member + 1);
+		}
+
+		template<typename Key, size_t key_count, size_t bucket_count>
+		constexpr uint16_t perfect_hash_slot_key(const Key (& keys)[key_count], const uint32_t (& sorted)[key_count], const uint32_t (& bucket_firsts)[bucket_count], const uint32_t (& bucket_sizes)[bucket_count], const uint32_t (& bucket_seeds)[bucket_count], const uint32_t (& slot_offsets)[bucket_count], size_t bucket, size_t slot)
+		{
+			return perfect_hash_slot_key(keys, sorted, bucket_firsts[bucket], bucket_sizes[bucket], bucket_seeds[bucket], slot - slot_offsets[bucket], 0);
+		}
+
+		// The index of the key occupying each slot
+		template<typename Key, size_t key_count, size_t bucket_count, size_t ... indices>
+		constexpr constant_array<uint16_t, sizeof...(indices)> make_slots(const Key (& keys)[key_count], const uint32_t (& sorted)[key_count], const uint32_t (& bucket_firsts)[bucket_count], const uint32_t (& bucket_sizes)[bucket_count], const uint32_t (& bucket_seeds)[bucket_count], const uint32_t (& slot_offsets)[bucket_count], utils::IndexSequence<indices...>)
+		{
+			return { { perfect_hash_slot_key(keys, sorted, bucket_firsts, bucket_sizes, bucket_seeds, slot_offsets, find_last_not_greater(slot_offsets, 0, bucket_count, indices), indices)... } };
+		}
+
+		// The descriptor of each bucket
+		template<size_t bucket_count, size_t ... indices>
+		constexpr constant_array<perfect_hash_bucket_entry, bucket_count> make_buckets(const uint32_t (& bucket_slot_counts)[bucket_count], const uint32_t (& bucket_seeds)[bucket_count], const uint32_t (& slot_offsets)[bucket_count], utils::IndexSequence<indices...>)
+		{
+			return { { perfect_hash_bucket_entry { static_cast<uint16_t>(slot_offsets[indices]), static_cast<uint8_t>(bucket_seeds[indices]), static_cast<uint8_t>(bucket_slot_counts[indices]) }... } };
+		}
+	}
+}
\ No newline at end of file
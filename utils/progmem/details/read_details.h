@@ -9,6 +9,8 @@
 // For memcpy_P, pgm_read_byte, ..., pgm_read_ptr
 #include <avr/pgmspace.h>
 
+#include "../../utils/Array.h"
+
 namespace progmem
 {
 	namespace details
@@ -45,10 +47,24 @@ namespace progmem
 			return read_progmem_helper<Type>::read_progmem(object);
 		}
 
-		// A type-safe read function for arrays,
-		// intentionally deleted until it's implemented
+		// A type-safe read function for a range of array elements
+		template<size_t offset, size_t count, typename Type, size_t size>
+		utils::Array<Type, count> read_progmem_range(const Type (& array)[size])
+		{
+			static_assert(count > 0, "count must be greater than 0");
+			static_assert((offset + count) <= size, "The range must lie within the array");
+
+			utils::Array<Type, count> result;
+			static_cast<void>(memcpy_P(result.data(), &array[offset], sizeof(Type) * count));
+			return result;
+		}
+
+		// A type-safe read function for arrays
 		template<typename Type, size_t size>
-		void read_progmem(const Type (& array)[size]) = delete;
+		utils::Array<Type, size> read_progmem(const Type (& array)[size])
+		{
+			return read_progmem_range<0, size>(array);
+		}
 
 		// A type-safe read function for pointers
 		template<typename Type>
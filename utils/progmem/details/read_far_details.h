@@ -0,0 +1,188 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint16_t, int16_t, uint32_t, int32_t, uintptr_t
+#include <stdint.h>
+
+// For uint_farptr_t, memcpy_PF, strlen_PF, strncmp_PF, pgm_read_byte_far, ..., pgm_read_float_far
+// For memcpy_P, strlen_P, strncmp_P, pgm_read_byte, ..., pgm_read_float
+#include <avr/pgmspace.h>
+
+namespace progmem
+{
+	namespace details
+	{
+		//
+		// The far progmem functions use the ELPM instruction,
+		// which only exists on devices with more than 64KB of progmem.
+		// On other devices, such as the ATmega32U4, every address fits in 16 bits,
+		// so far addresses are read with the near functions instead.
+		//
+
+#if defined(__AVR_HAVE_ELPM__)
+		inline uint8_t far_read_byte(uint_farptr_t address)
+		{
+			return pgm_read_byte_far(address);
+		}
+
+		inline uint16_t far_read_word(uint_farptr_t address)
+		{
+			return pgm_read_word_far(address);
+		}
+
+		inline uint32_t far_read_dword(uint_farptr_t address)
+		{
+			return pgm_read_dword_far(address);
+		}
+
+		inline float far_read_float(uint_farptr_t address)
+		{
+			return pgm_read_float_far(address);
+		}
+
+		inline void far_copy(void * destination, uint_farptr_t source, size_t size)
+		{
+			static_cast<void>(memcpy_PF(destination, source, size));
+		}
+
+		inline size_t far_length(uint_farptr_t string)
+		{
+			return strlen_PF(string);
+		}
+
+		inline int far_compare(const char * left, uint_farptr_t right, size_t size)
+		{
+			return strncmp_PF(left, right, size);
+		}
+#else
+		inline const void * near_address(uint_farptr_t address)
+		{
+			return reinterpret_cast<const void *>(static_cast<uintptr_t>(address));
+		}
+
+		inline uint8_t far_read_byte(uint_farptr_t address)
+		{
+			return pgm_read_byte(near_address(address));
+		}
+
+		inline uint16_t far_read_word(uint_farptr_t address)
+		{
+			return pgm_read_word(near_address(address));
+		}
+
+		inline uint32_t far_read_dword(uint_farptr_t address)
+		{
+			return pgm_read_dword(near_address(address));
+		}
+
+		inline float far_read_float(uint_farptr_t address)
+		{
+			return pgm_read_float(near_address(address));
+		}
+
+		inline void far_copy(void * destination, uint_farptr_t source, size_t size)
+		{
+			static_cast<void>(memcpy_P(destination, near_address(source), size));
+		}
+
+		inline size_t far_length(uint_farptr_t string)
+		{
+			return strlen_P(static_cast<const char *>(near_address(string)));
+		}
+
+		inline int far_compare(const char * left, uint_farptr_t right, size_t size)
+		{
+			return strncmp_P(left, static_cast<const char *>(near_address(right)), size);
+		}
+#endif
+
+		// Default behaviour - a type-safe wrapper for far_copy
+		template<typename Type, size_t size = sizeof(Type)>
+		struct read_progmem_far_helper
+		{
+			static Type read_progmem_far(uint_farptr_t address)
+			{
+				Type result;
+				far_copy(&result, address, sizeof(Type));
+				return result;
+			}
+		};
+
+		// Special behaviour for single-byte types
+		template<typename Type>
+		struct read_progmem_far_helper<Type, 1>
+		{
+			static Type read_progmem_far(uint_farptr_t address)
+			{
+				Type result;
+				const auto result_pointer = reinterpret_cast<unsigned char *>(&result);
+				*result_pointer = far_read_byte(address);
+				return result;
+			}
+		};
+
+		// A type-safe read function for general objects.
+		// Unlike read_progmem, the type can't be inferred from the address,
+		// so the common 'pgm_read_far' functions are selected by specialisation.
+		template<typename Type>
+		Type read_progmem_far(uint_farptr_t address)
+		{
+			return read_progmem_far_helper<Type>::read_progmem_far(address);
+		}
+
+		//
+		// Type-safe read functions,
+		// wrapping all the common 'pgm_read_far' functions.
+		//
+
+		template<>
+		inline char read_progmem_far<char>(uint_farptr_t address)
+		{
+			return far_read_byte(address);
+		}
+
+		template<>
+		inline uint8_t read_progmem_far<uint8_t>(uint_farptr_t address)
+		{
+			return far_read_byte(address);
+		}
+
+		template<>
+		inline int8_t read_progmem_far<int8_t>(uint_farptr_t address)
+		{
+			return far_read_byte(address);
+		}
+
+		template<>
+		inline uint16_t read_progmem_far<uint16_t>(uint_farptr_t address)
+		{
+			return far_read_word(address);
+		}
+
+		template<>
+		inline int16_t read_progmem_far<int16_t>(uint_farptr_t address)
+		{
+			return far_read_word(address);
+		}
+
+		template<>
+		inline uint32_t read_progmem_far<uint32_t>(uint_farptr_t address)
+		{
+			return far_read_dword(address);
+		}
+
+		template<>
+		inline int32_t read_progmem_far<int32_t>(uint_farptr_t address)
+		{
+			return far_read_dword(address);
+		}
+
+		template<>
+		inline float read_progmem_far<float>(uint_farptr_t address)
+		{
+			return far_read_float(address);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t, uint16_t, uint32_t
+#include <stdint.h>
+
+// For utils::IndexSequence
+#include "../../utils.h"
+
+#include "constexpr_details.h"
+
+namespace progmem
+{
+	namespace details
+	{
+		// The longest run that a single length byte can represent
+		constexpr uint32_t rle_maximum_run = 255;
+
+		// The number of runs between consecutive checkpoints
+		constexpr size_t rle_checkpoint_interval = 16;
+
+		// 1 where an element differs from the element before it, otherwise 0
+		template<typename Type, size_t size, size_t ... indices>
+		constexpr constant_array<uint32_t, size> make_rle_changes(const Type (& values)[size], utils::IndexSequence<indices...>)
+		{
+			return { { (((indices == 0) || !(values[indices] == values[indices - 1])) ? 1u : 0u)... } };
+		}
+
+		// Converts exclusive prefix sums into inclusive prefix sums
+		template<size_t size, size_t ... indices>
+		constexpr constant_array<uint32_t, size> make_inclusive_sums(const uint32_t (& exclusive)[size], const uint32_t (& values)[size], utils::IndexSequence<indices...>)
+		{
+			return { { (exclusive[indices] + values[indices])... } };
+		}
+
+		// 1 where a run starts, otherwise 0.
+		// A run starts at each change, and every 255 elements
+		// into a span of equal elements, which is found by searching
+		// the running count of changes for the first element with the same count.
+		template<size_t size, size_t ... indices>
+		constexpr constant_array<uint32_t, size> make_rle_starts(const uint32_t (& changes)[size], utils::IndexSequence<indices...>)
+		{
+			return { { (((indices - lower_bound(changes, 0, size, changes[indices])) % rle_maximum_run) == 0 ? 1u : 0u)... } };
+		}
+
+		// The index of the first element of each run
+		template<size_t size, size_t ... indices>
+		constexpr constant_array<uint32_t, sizeof...(indices)> make_rle_run_firsts(const uint32_t (& starts)[size], utils::IndexSequence<indices...>)
+		{
+			return { { static_cast<uint32_t>(lower_bound(starts, 0, size, static_cast<uint32_t>(indices + 1)))... } };
+		}
+
+		// The value of each run
+		template<typename Type, size_t size, size_t run_count, size_t ... indices>
+		constexpr constant_array<Type, run_count> make_rle_values(const Type (& values)[size], const uint32_t (& run_firsts)[run_count], utils::IndexSequence<indices...>)
+		{
+			return { { values[run_firsts[indices]]... } };
+		}
+
+		// The length of each run, followed by a zero length that terminates the runs
+		template<size_t size, size_t run_count, size_t ... indices>
+		constexpr constant_array<uint8_t, run_count + 1> make_rle_lengths(const uint32_t (& run_firsts)[run_count], utils::IndexSequence<indices...>)
+		{
+			return { { static_cast<uint8_t>((((indices + 1) < run_count) ? run_firsts[indices + 1] : size) - run_firsts[indices])..., 0 } };
+		}
+
+		// The index of the first element of every rle_checkpoint_interval-th run
+		template<size_t run_count, size_t ... indices>
+		constexpr constant_array<uint16_t, sizeof...(indices)> make_rle_checkpoints(const uint32_t (& run_firsts)[run_count], utils::IndexSequence<indices...>)
+		{
+			return { { static_cast<uint16_t>(run_firsts[indices * rle_checkpoint_interval])... } };
+		}
+
+		constexpr size_t rle_checkpoint_count(size_t run_count)
+		{
+			return ((run_count + (rle_checkpoint_interval - 1)) / rle_checkpoint_interval);
+		}
+	}
+}
\ No newline at end of file
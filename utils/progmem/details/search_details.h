@@ -0,0 +1,162 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+#include "../ProgmemPointer.h"
+#include "constexpr_details.h"
+
+namespace progmem
+{
+	namespace details
+	{
+		// Ranges longer than this are searched with a fixed number of probes
+		constexpr size_t branchless_search_threshold = 256;
+
+		// Reads the whole element as the key
+		template<typename Type>
+		struct element_key
+		{
+			Type operator()(ProgmemPointer<Type> pointer) const
+			{
+				return *pointer;
+			}
+		};
+
+		// Reads only the key member of the element
+		template<typename Member, typename Class>
+		struct member_key
+		{
+			Member Class::* member;
+
+			template<typename Type>
+			Member operator()(ProgmemPointer<Type> pointer) const
+			{
+				return pointer.member(this->member);
+			}
+		};
+
+		// True for elements whose key is less than 'key'
+		template<typename KeyReader, typename Key>
+		struct key_less
+		{
+			KeyReader read_key;
+			const Key & key;
+
+			template<typename Type>
+			bool operator()(ProgmemPointer<Type> pointer) const
+			{
+				return (this->read_key(pointer) < this->key);
+			}
+		};
+
+		// True for elements whose key is not greater than 'key'
+		template<typename KeyReader, typename Key>
+		struct key_not_greater
+		{
+			KeyReader read_key;
+			const Key & key;
+
+			template<typename Type>
+			bool operator()(ProgmemPointer<Type> pointer) const
+			{
+				return !(this->key < this->read_key(pointer));
+			}
+		};
+
+		// Returns the first element of [first, first + count) for which 'predicate' is false,
+		// assuming every element for which it is true comes before every element for which it is false.
+		// Stops probing as soon as the range is empty.
+		template<typename Type, typename Predicate>
+		ProgmemPointer<Type> partition_point(ProgmemPointer<Type> first, size_t count, Predicate predicate)
+		{
+			while(count > 0)
+			{
+				const size_t half = (count / 2);
+				const ProgmemPointer<Type> middle = (first + static_cast<ptrdiff_t>(half));
+
+				if(predicate(middle))
+				{
+					first = (middle + 1);
+					count -= (half + 1);
+				}
+				else
+				{
+					count = half;
+				}
+			}
+
+			return first;
+		}
+
+		// As partition_point, but always makes ceil(log2(count)) + 1 probes,
+		// and advances with a mask rather than a data-dependent branch.
+		template<typename Type, typename Predicate>
+		ProgmemPointer<Type> partition_point_branchless(ProgmemPointer<Type> first, size_t count, Predicate predicate)
+		{
+			if(count == 0)
+				return first;
+
+			while(count > 1)
+			{
+				const size_t half = (count / 2);
+				const size_t mask = -static_cast<size_t>(predicate(first + static_cast<ptrdiff_t>(half)));
+
+				first = (first + static_cast<ptrdiff_t>(half & mask));
+				count -= half;
+			}
+
+			return (first + static_cast<ptrdiff_t>(predicate(first)));
+		}
+
+		template<typename Type, typename Predicate>
+		ProgmemPointer<Type> search(ProgmemPointer<Type> first, ProgmemPointer<Type> last, Predicate predicate)
+		{
+			const size_t count = static_cast<size_t>(last - first);
+
+			return (count > branchless_search_threshold) ?
+				partition_point_branchless(first, count, predicate) :
+				partition_point(first, count, predicate);
+		}
+
+		template<typename Type, typename KeyReader, typename Key>
+		ProgmemPointer<Type> lower_bound(ProgmemPointer<Type> first, ProgmemPointer<Type> last, const Key & key, KeyReader read_key)
+		{
+			return search(first, last, key_less<KeyReader, Key> { read_key, key });
+		}
+
+		template<typename Type, typename KeyReader, typename Key>
+		ProgmemPointer<Type> upper_bound(ProgmemPointer<Type> first, ProgmemPointer<Type> last, const Key & key, KeyReader read_key)
+		{
+			return search(first, last, key_not_greater<KeyReader, Key> { read_key, key });
+		}
+
+		template<typename Type, typename KeyReader, typename Key>
+		bool binary_search(ProgmemPointer<Type> first, ProgmemPointer<Type> last, const Key & key, KeyReader read_key)
+		{
+			const ProgmemPointer<Type> result = lower_bound(first, last, key, read_key);
+
+			return ((result != last) && !(key < read_key(result)));
+		}
+
+		// Returns true if array[begin, end) is sorted in ascending order
+		template<typename Type, size_t size>
+		constexpr bool is_sorted(const Type (& array)[size], size_t begin, size_t end)
+		{
+			return ((end - begin) <= 1) ? true :
+				(is_sorted(array, begin, middle_index(begin, end)) &&
+				is_sorted(array, middle_index(begin, end), end) &&
+				!(array[middle_index(begin, end)] < array[middle_index(begin, end) - 1]));
+		}
+
+		// Returns true if the members of array[begin, end) are sorted in ascending order
+		template<typename Type, size_t size, typename Member, typename Class>
+		constexpr bool is_sorted(const Type (& array)[size], Member Class::* member, size_t begin, size_t end)
+		{
+			return ((end - begin) <= 1) ? true :
+				(is_sorted(array, member, begin, middle_index(begin, end)) &&
+				is_sorted(array, member, middle_index(begin, end), end) &&
+				!(array[middle_index(begin, end)].*member < array[middle_index(begin, end) - 1].*member));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For pgm_read_byte
+#include <avr/pgmspace.h>
+
+namespace progmem
+{
+	namespace details
+	{
+		// Holds ProgmemString::npos.
+		// A template, so that its out-of-class definition
+		// can live in a header without breaking the one definition rule.
+		template<typename Dummy = void>
+		struct string_constants
+		{
+			static constexpr size_t npos = static_cast<size_t>(-1);
+		};
+
+		// Definitions of the static data members, as required by C++11
+		template<typename Dummy>
+		constexpr size_t string_constants<Dummy>::npos;
+
+		// Compares two null-terminated strings that are both stored in progmem.
+		// avr-libc only provides functions that compare a string in RAM
+		// against a string in progmem, hence the need for this function.
+		// Returns a negative value, zero or a positive value, as per strcmp.
+		inline int compare_progmem_strings(const char * left, const char * right)
+		{
+			while(true)
+			{
+				const unsigned char left_char = pgm_read_byte(left);
+				const unsigned char right_char = pgm_read_byte(right);
+
+				if((left_char != right_char) || (left_char == '\0'))
+					return (static_cast<int>(left_char) - static_cast<int>(right_char));
+
+				++left;
+				++right;
+			}
+		}
+
+		// Compares the first 'size' characters of two strings that are both stored in progmem.
+		// Returns a negative value, zero or a positive value, as per memcmp.
+		inline int compare_progmem_memory(const char * left, const char * right, size_t size)
+		{
+			for(size_t index = 0; index < size; ++index)
+			{
+				const unsigned char left_char = pgm_read_byte(&left[index]);
+				const unsigned char right_char = pgm_read_byte(&right[index]);
+
+				if(left_char != right_char)
+					return (static_cast<int>(left_char) - static_cast<int>(right_char));
+			}
+
+			return 0;
+		}
+	}
+}
\ No newline at end of file
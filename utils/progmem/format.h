@@ -0,0 +1,86 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For Print
+#include <Print.h>
+
+#include "ProgmemString.h"
+#include "details/format_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Writes a format string stored in progmem to `output`,
+	/// replacing each placeholder with the next argument.
+	///
+	/// @details
+	/// The format string is read directly from progmem one character at a time,
+	/// and numbers are written one digit at a time,
+	/// so no part of the output is ever buffered in RAM.
+	///
+	/// A placeholder has the form `{}` or `{:spec}`,
+	/// where `spec` is made of the following, each of which is optional, in order:
+	/// * `<` - Left-align within the width, rather than right-align.
+	/// * `0` - Pad numbers with zeros rather than spaces.
+	/// * A decimal number - The minimum width.
+	/// * `.` followed by a decimal number - For integers, the number of decimal places.
+	///   The argument is treated as a fixed-point number scaled by that power of ten.
+	///   For strings, the maximum number of characters.
+	/// * `x` or `X` - Write an integer in lower-case or upper-case hexadecimal.
+	///
+	/// `{{` and `}}` write a single brace.
+	///
+	/// Arguments may be `char`, any integer type of up to 32 bits,
+	/// `const char *`, @ref ProgmemString or `const __FlashStringHelper *`.
+	/// Passing any other type is a compile error.
+	///
+	/// Placeholders beyond the last argument write nothing,
+	/// and arguments beyond the last placeholder are ignored.
+	///
+	/// E.g.
+	/// ```
+	/// // Writes "HP  42/100 $12.05 0x00FF"
+	/// progmem::format(arduboy, PROGMEM_STRING("HP {:3}/{} ${:.2} 0x{:04X}"), 42, 100, 1205, 255);
+	/// ```
+	///
+	/// @return
+	/// The number of characters written.
+	template<typename ... Arguments>
+	size_t format(Print & output, const ProgmemString & string, const Arguments & ... arguments)
+	{
+		static_assert(sizeof...(Arguments) < 256, "Too many format arguments");
+
+		// The extra element allows an empty argument list
+		const details::format_argument values[sizeof...(Arguments) + 1] { arguments... };
+
+		return details::format_progmem(output, static_cast<const char *>(string), string.length(), values, sizeof...(Arguments));
+	}
+
+	/// @brief
+	/// Writes a null-terminated format string stored in progmem to `output`,
+	/// replacing each placeholder with the next argument.
+	///
+	/// @details
+	/// Behaves the same as @ref format(Print &, const ProgmemString &, const Arguments & ...),
+	/// but accepts the result of Arduino's `F` macro.
+	///
+	/// E.g.
+	/// ```
+	/// progmem::format(arduboy, F("Score: {:06}"), score);
+	/// ```
+	///
+	/// @return
+	/// The number of characters written.
+	template<typename ... Arguments>
+	size_t format(Print & output, const __FlashStringHelper * string, const Arguments & ... arguments)
+	{
+		static_assert(sizeof...(Arguments) < 256, "Too many format arguments");
+
+		// The extra element allows an empty argument list
+		const details::format_argument values[sizeof...(Arguments) + 1] { arguments... };
+
+		return details::format_progmem(output, reinterpret_cast<const char *>(string), ProgmemString::npos, values, sizeof...(Arguments));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+#include "details/search_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Returns `true` if the elements of `array` are in ascending order, otherwise returns `false`.
+	///
+	/// @details
+	/// Intended to be used in a `static_assert` on a `constexpr` table,
+	/// so that a table that is searched with @ref lowerBound, @ref upperBound
+	/// or @ref binarySearch is known to be sorted at compile time.
+	///
+	/// E.g.
+	/// ```
+	/// constexpr uint16_t thresholds[] PROGMEM { 10, 20, 50, 100 };
+	///
+	/// static_assert(progmem::isSorted(thresholds), "thresholds must be sorted");
+	/// ```
+	template<typename Type, size_t size>
+	constexpr bool isSorted(const Type (& array)[size])
+	{
+		return details::is_sorted(array, 0, size);
+	}
+
+	/// @brief
+	/// Returns `true` if the `member` of each element of `array` is in ascending order,
+	/// otherwise returns `false`.
+	///
+	/// @details
+	/// Intended to be used in a `static_assert` on a `constexpr` table.
+	///
+	/// E.g.
+	/// ```
+	/// static_assert(progmem::isSorted(items, &Item::id), "items must be sorted by id");
+	/// ```
+	template<typename Type, size_t size, typename Member, typename Class>
+	constexpr bool isSorted(const Type (& array)[size], Member Class::* member)
+	{
+		return details::is_sorted(array, member, 0, size);
+	}
+}
\ No newline at end of file
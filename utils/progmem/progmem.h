@@ -4,9 +4,30 @@ namespace progmem {}
 
 #include "readProgmem.h"
 #include "copyProgmem.h"
+#include "readProgmemFar.h"
 
 #include "ProgmemReference.h"
 #include "ProgmemPointer.h"
 #include "ProgmemArray.h"
+#include "BufferedIterator.h"
+#include "ProgmemColumnIterator.h"
+#include "ProgmemGrid.h"
+#include "lowerBound.h"
+#include "upperBound.h"
+#include "binarySearch.h"
+#include "isSorted.h"
+#include "RleArray.h"
+#include "RleEncoding.h"
+#include "LookupTable.h"
+#include "QuarterWaveTable.h"
 #include "ProgmemString.h"
-#include "ProgmemNullString.h"
\ No newline at end of file
+#include "ProgmemNullString.h"
+#include "format.h"
+#include "ProgmemFarReference.h"
+#include "ProgmemFarPointer.h"
+#include "ProgmemFarArray.h"
+#include "ProgmemFarString.h"
+
+#include "StringSwitch.h"
+#include "PerfectHashMap.h"
+#include "CompressedStream.h"
\ No newline at end of file
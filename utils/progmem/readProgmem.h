@@ -36,8 +36,36 @@ namespace progmem
 	/// Calling this function on an object that is not stored in progmem
 	/// will result in <strong>undefined behaviour</strong>.
 	///
-	/// @todo
-	/// This function is presently unimplemented.
+	/// @details
+	/// The whole array is copied with a single block read.
 	template<typename Type, size_t size>
-	utils::Array<Type, size> readProgmem(const Type (& array)[size]) = delete;
+	utils::Array<Type, size> readProgmem(const Type (& array)[size])
+	{
+		return details::read_progmem(array);
+	}
+
+	/// @brief
+	/// Reads `count` elements of an array from progmem, starting from the element at `offset`.
+	///
+	/// @details
+	/// Only the requested elements are copied, with a single block read.
+	/// The range is checked at compile time.
+	///
+	/// E.g.
+	/// ```
+	/// const auto row = progmem::readProgmem<16, 8>(tiles);
+	/// ```
+	///
+	/// @note
+	/// The object type must be trivially copyable.
+	///
+	/// @warning
+	/// There is no way to verify that the provided reference refers to an array in progmem.
+	/// Calling this function on an object that is not stored in progmem
+	/// will result in <strong>undefined behaviour</strong>.
+	template<size_t offset, size_t count, typename Type, size_t size>
+	utils::Array<Type, count> readProgmem(const Type (& array)[size])
+	{
+		return details::read_progmem_range<offset, count>(array);
+	}
 }
\ No newline at end of file
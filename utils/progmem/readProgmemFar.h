@@ -0,0 +1,32 @@
+#pragma once
+
+// For uint_farptr_t
+#include <avr/pgmspace.h>
+
+#include "details/read_far_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Reads an object from anywhere in progmem, including above the first 64KB.
+	///
+	/// @details
+	/// The address of an object can be obtained with avr-libc's `pgm_get_far_address` macro.
+	///
+	/// E.g.
+	/// ```
+	/// const uint16_t value = progmem::readProgmemFar<uint16_t>(pgm_get_far_address(far_table[index]));
+	/// ```
+	///
+	/// @note
+	/// The object type must be trivially copyable.
+	///
+	/// @warning
+	/// There is no way to verify that the provided address refers to an object of the specified type.
+	/// Calling this function with any other address will result in <strong>undefined behaviour</strong>.
+	template<typename Type>
+	Type readProgmemFar(uint_farptr_t address)
+	{
+		return details::read_progmem_far<Type>(address);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+#include "ProgmemPointer.h"
+#include "ProgmemArray.h"
+#include "details/search_details.h"
+
+namespace progmem
+{
+	/// @brief
+	/// Returns a pointer to the first element of [`first`, `last`) that is greater than `key`, or `last` if there is no such element.
+	///
+	/// @details
+	/// Each probe reads one element from progmem.
+	/// Nothing is copied into RAM in advance.
+	///
+	/// Ranges of more than 256 elements are searched with a fixed number of probes
+	/// and no data-dependent branches.
+	///
+	/// @warning
+	/// The range must be sorted in ascending order of key,
+	/// otherwise the result is unspecified.
+	template<typename Type, typename Key>
+	ProgmemPointer<Type> upperBound(ProgmemPointer<Type> first, ProgmemPointer<Type> last, const Key & key)
+	{
+		return details::upper_bound(first, last, key, details::element_key<Type>());
+	}
+
+	/// @brief
+	/// Returns a pointer to the first element of [`first`, `last`) whose `member` is greater than `key`, or `last` if there is no such element.
+	///
+	/// @details
+	/// Only the `member` of each probed element is read from progmem,
+	/// rather than the whole element.
+	///
+	/// E.g.
+	/// ```
+	/// auto result = progmem::upperBound(items.begin(), items.end(), id, &Item::id);
+	/// ```
+	///
+	/// @warning
+	/// The range must be sorted in ascending order of key,
+	/// otherwise the result is unspecified.
+	template<typename Type, typename Key, typename Member, typename Class>
+	ProgmemPointer<Type> upperBound(ProgmemPointer<Type> first, ProgmemPointer<Type> last, const Key & key, Member Class::* member)
+	{
+		return details::upper_bound(first, last, key, details::member_key<Member, Class> { member });
+	}
+
+	/// @brief
+	/// Returns a pointer to the first element of `array` that is greater than `key`, or `array.end()` if there is no such element.
+	///
+	/// @warning
+	/// The range must be sorted in ascending order of key,
+	/// otherwise the result is unspecified.
+	template<typename Type, size_t capacity, typename Key>
+	typename ProgmemArray<Type, capacity>::const_iterator upperBound(const ProgmemArray<Type, capacity> & array, const Key & key)
+	{
+		return upperBound(array.begin(), array.end(), key);
+	}
+
+	/// @brief
+	/// Returns a pointer to the first element of `array` whose `member` is greater than `key`, or `array.end()` if there is no such element.
+	///
+	/// @details
+	/// Only the `member` of each probed element is read from progmem,
+	/// rather than the whole element.
+	///
+	/// @warning
+	/// The range must be sorted in ascending order of key,
+	/// otherwise the result is unspecified.
+	template<typename Type, size_t capacity, typename Key, typename Member, typename Class>
+	typename ProgmemArray<Type, capacity>::const_iterator upperBound(const ProgmemArray<Type, capacity> & array, const Key & key, Member Class::* member)
+	{
+		return upperBound(array.begin(), array.end(), key, member);
+	}
+}
\ No newline at end of file
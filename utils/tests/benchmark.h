@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Arduboy2.h>
+
+namespace tests
+{
+	// Calls 'function' with each index below 'iterations',
+	// then prints the name and the number of microseconds taken.
+	//
+	// Returns the result of the last call, which is stored
+	// in a volatile to prevent the calls being optimised away.
+	template<typename Function>
+	auto benchmark(Arduboy2 & arduboy, const __FlashStringHelper * name, uint16_t iterations, Function function)
+		-> decltype(function(uint16_t()))
+	{
+		volatile decltype(function(uint16_t())) result {};
+
+		const auto start = micros();
+
+		for(uint16_t index = 0; index < iterations; ++index)
+			result = function(index);
+
+		const auto end = micros();
+
+		arduboy.print(name);
+		arduboy.print(' ');
+		arduboy.println(end - start);
+
+		return result;
+	}
+}
\ No newline at end of file
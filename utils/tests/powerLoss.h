@@ -0,0 +1,66 @@
+#pragma once
+
+// For eeprom_read_byte, eeprom_write_byte
+#include <avr/eeprom.h>
+
+namespace tests
+{
+	// An eeprom writer that simulates power being lost partway through a write.
+	//
+	// Writes a byte at a time, skipping identical bytes as eeprom::EepromWriter does,
+	// until 'budget' bytes have been written.
+	// Every write after that is discarded, as if power had been lost.
+	struct PowerLossWriter
+	{
+		static constexpr uint16_t unlimited = 0xFFFF;
+
+		static uint16_t & budget()
+		{
+			static uint16_t value = unlimited;
+			return value;
+		}
+
+		// Returns true if any write was discarded since the budget was set
+		static bool & lost()
+		{
+			static bool value = false;
+			return value;
+		}
+
+		static void cutAfter(uint16_t bytes)
+		{
+			budget() = bytes;
+			lost() = false;
+		}
+
+		static void restore()
+		{
+			budget() = unlimited;
+		}
+
+		static void write(void * destination, const void * source, size_t size)
+		{
+			uint8_t * destinationBytes = static_cast<uint8_t *>(destination);
+			const uint8_t * sourceBytes = static_cast<const uint8_t *>(source);
+
+			for(size_t index = 0; index < size; ++index)
+			{
+				if(eeprom_read_byte(&destinationBytes[index]) == sourceBytes[index])
+					continue;
+
+				if(budget() == 0)
+				{
+					lost() = true;
+					continue;
+				}
+
+				if(budget() != unlimited)
+					--budget();
+
+				eeprom_write_byte(&destinationBytes[index], sourceBytes[index]);
+			}
+		}
+	};
+
+	constexpr uint16_t PowerLossWriter::unlimited;
+}
\ No newline at end of file
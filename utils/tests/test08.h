@@ -0,0 +1,76 @@
+#include <Arduboy2.h>
+
+#include "../progmem.h"
+#include "../containers.h"
+#include "../utils/View/views.h"
+
+namespace test08
+{
+	const char test_data[] PROGMEM = "Hello world";
+
+	containers::Deque<int, 16> deque;
+
+	void test(Arduboy2 & arduboy)
+	{
+		auto array = progmem::makeProgmemArray(test_data);
+
+		auto isLetter = [](char c) { return (c != ' ') && (c != '\0'); };
+		auto toUpper = [](char c) { return ((c >= 'a') && (c <= 'z')) ? static_cast<char>(c - ('a' - 'A')) : c; };
+
+		// HELLOWORLD
+		for(char c : array | utils::filter(isLetter) | utils::transform(toUpper))
+			arduboy.print(c);
+		arduboy.println();
+
+		// world
+		for(char c : array | utils::drop(6) | utils::take(5))
+			arduboy.print(c);
+		arduboy.println();
+
+		// Hlowrd
+		for(char c : array | utils::take(11) | utils::stride(2))
+			arduboy.print(c);
+		arduboy.println();
+
+		for(int value = 0; value < 10; ++value)
+			deque.push_back(value);
+
+		// 0:0 1:2 2:4 3:6 4:8
+		for(auto pair : deque | utils::stride(2) | utils::enumerate())
+		{
+			arduboy.print(static_cast<int>(pair.first));
+			arduboy.print(':');
+			arduboy.print(pair.second);
+			arduboy.print(' ');
+		}
+		arduboy.println();
+
+		// H0 e1 l2 l3 o4  5 w6 o7 r8 l9
+		for(auto pair : array | utils::zip(deque))
+		{
+			arduboy.print(static_cast<char>(pair.first));
+			arduboy.print(pair.second);
+			arduboy.print(' ');
+		}
+		arduboy.println();
+
+		// Adapted iterators name the type of the elements they produce
+		// H0
+		{
+			auto zipped = array | utils::zip(deque);
+			const auto element = *zipped.begin();
+			const decltype(zipped.begin())::value_type first { element.first, element.second };
+			arduboy.print(first.first);
+			arduboy.println(first.second);
+		}
+
+		// 0123 4567 89
+		for(auto chunk : deque | utils::chunk(4))
+		{
+			for(int value : chunk)
+				arduboy.print(value);
+			arduboy.print(' ');
+		}
+		arduboy.println();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include <Arduboy2.h>
+
+#include "benchmark.h"
+
+#include "../progmem.h"
+
+namespace test09
+{
+	const char string_a[] PROGMEM = "The quick brown fox jumps over the lazy dog";
+	const char string_b[] PROGMEM = "The quick brown fox jumps over the lazy dog";
+	const char string_c[] PROGMEM = "A completely different string";
+
+	constexpr uint16_t iterations = 1000;
+
+	void test(Arduboy2 & arduboy)
+	{
+		const progmem::ProgmemNullString a(string_a);
+		const progmem::ProgmemNullString b(string_b);
+		const progmem::ProgmemNullString c(string_c);
+
+		// Identical pointers, no reads
+		tests::benchmark(arduboy, F("a==a"), iterations, [&](uint16_t) { return (a == a); });
+
+		// Identical contents, one full scan
+		tests::benchmark(arduboy, F("a==b"), iterations, [&](uint16_t) { return (a == b); });
+
+		// Differ at the first character, one read of each
+		tests::benchmark(arduboy, F("a==c"), iterations, [&](uint16_t) { return (a == c); });
+
+		// Size computed once, then reused
+		const auto sized = progmem::makeProgmemString(a);
+		arduboy.println(sized.size());
+		arduboy.println(a == b);
+		arduboy.println(a != c);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include <Arduboy2.h>
+
+#include "../progmem.h"
+
+namespace test10
+{
+	const char command_move[] PROGMEM = "move";
+	const char command_jump[] PROGMEM = "jump";
+	const char command_move_copy[] PROGMEM = "move";
+
+	void test(Arduboy2 & arduboy)
+	{
+		const progmem::ProgmemString move(command_move);
+		const progmem::ProgmemString jump(command_jump);
+		const progmem::ProgmemString move_copy(command_move_copy);
+
+		// Flash against flash, different addresses
+		arduboy.println(move == move_copy);
+		arduboy.println(move != jump);
+		arduboy.println(move.compare(jump) > 0);
+
+		// RAM against flash, without copying
+		char token[] = "jump";
+		arduboy.println(jump == token);
+		arduboy.println(move.compare(token) > 0);
+
+		auto string = PROGMEM_STRING("Hello world");
+
+		arduboy.println(static_cast<int>(string.length()));
+		arduboy.println(static_cast<int>(string.find('o')));
+		arduboy.println(static_cast<int>(string.find('o', 5)));
+		arduboy.println(static_cast<int>(string.find("world")));
+		arduboy.println(string.find(jump) == progmem::ProgmemString::npos);
+		arduboy.println(string.starts_with("Hello"));
+		arduboy.println(string.ends_with("world"));
+		arduboy.println(string.ends_with('d'));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include <Arduboy2.h>
+
+#include "../progmem.h"
+
+namespace test11
+{
+	using Handler = void (*)(Arduboy2 & arduboy);
+
+	void onMove(Arduboy2 & arduboy) { arduboy.println(F("Moving")); }
+	void onJump(Arduboy2 & arduboy) { arduboy.println(F("Jumping")); }
+	void onFire(Arduboy2 & arduboy) { arduboy.println(F("Firing")); }
+	void onUnknown(Arduboy2 & arduboy) { arduboy.println(F("Unknown")); }
+
+	constexpr char command_move[] PROGMEM = "move";
+	constexpr char command_jump[] PROGMEM = "jump";
+	constexpr char command_fire[] PROGMEM = "fire";
+
+	constexpr progmem::StringSwitchEntry<Handler> entries[]
+	{
+		progmem::makeStringSwitchEntry<Handler>(command_move, onMove),
+		progmem::makeStringSwitchEntry<Handler>(command_jump, onJump),
+		progmem::makeStringSwitchEntry<Handler>(command_fire, onFire),
+	};
+
+	constexpr auto table PROGMEM = progmem::makeStringSwitchTable(entries);
+
+	static_assert(table.entries[0].hash <= table.entries[1].hash, "Table is not sorted");
+	static_assert(table.entries[1].hash <= table.entries[2].hash, "Table is not sorted");
+
+	void test(Arduboy2 & arduboy)
+	{
+		const auto dispatcher = progmem::makeStringSwitch(table);
+
+		// Tokens within a larger buffer, as if read from serial
+		const char buffer[] = "jump fire move walk";
+
+		dispatcher.find(&buffer[0], 4, onUnknown)(arduboy);
+		dispatcher.find(&buffer[5], 4, onUnknown)(arduboy);
+		dispatcher.find(&buffer[10], 4, onUnknown)(arduboy);
+		dispatcher.find(&buffer[15], 4, onUnknown)(arduboy);
+		dispatcher.find("fir", onUnknown)(arduboy);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include <Arduboy2.h>
+
+#include "../progmem.h"
+
+namespace test12
+{
+	// Generates 1024 distinct keys.
+	// (Multiplying by an odd number is a bijection on 16-bit integers.)
+	#define TEST12_KEY(index) static_cast<uint16_t>(((index) * 40503u) ^ 0x5A5Au)
+	#define TEST12_KEYS_4(index) TEST12_KEY(index), TEST12_KEY(index + 1), TEST12_KEY(index + 2), TEST12_KEY(index + 3)
+	#define TEST12_KEYS_16(index) TEST12_KEYS_4(index), TEST12_KEYS_4(index + 4), TEST12_KEYS_4(index + 8), TEST12_KEYS_4(index + 12)
+	#define TEST12_KEYS_64(index) TEST12_KEYS_16(index), TEST12_KEYS_16(index + 16), TEST12_KEYS_16(index + 32), TEST12_KEYS_16(index + 48)
+	#define TEST12_KEYS_256(index) TEST12_KEYS_64(index), TEST12_KEYS_64(index + 64), TEST12_KEYS_64(index + 128), TEST12_KEYS_64(index + 192)
+
+	constexpr uint16_t keys[] PROGMEM
+	{
+		TEST12_KEYS_256(0), TEST12_KEYS_256(256), TEST12_KEYS_256(512), TEST12_KEYS_256(768),
+	};
+
+	constexpr uint16_t values[] PROGMEM
+	{
+		TEST12_KEYS_256(0), TEST12_KEYS_256(256), TEST12_KEYS_256(512), TEST12_KEYS_256(768),
+	};
+
+	#undef TEST12_KEYS_256
+	#undef TEST12_KEYS_64
+	#undef TEST12_KEYS_16
+	#undef TEST12_KEYS_4
+	#undef TEST12_KEY
+
+	using Map = progmem::PerfectHashMap<uint16_t, uint16_t, utils::size(keys), keys, values>;
+
+	void test(Arduboy2 & arduboy)
+	{
+		uint16_t found = 0;
+		uint16_t correct = 0;
+
+		for(size_t index = 0; index < utils::size(keys); ++index)
+		{
+			const uint16_t key = progmem::readProgmem(keys[index]);
+			const auto value = Map::find(key);
+
+			if(value != nullptr)
+				++found;
+
+			if(Map::get(key, 0) == key)
+				++correct;
+		}
+
+		// 1024 1024
+		arduboy.print(found);
+		arduboy.print(' ');
+		arduboy.println(correct);
+
+		// Every possible key, to check for false positives
+		uint16_t contained = 0;
+		uint16_t key = 0;
+
+		do
+		{
+			if(Map::contains(key))
+				++contained;
+
+			++key;
+		}
+		while(key != 0);
+
+		// 1024
+		arduboy.println(contained);
+
+		// Total slots
+		arduboy.println(static_cast<int>(Map::hash_type::slot_count));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include <Arduboy2.h>
+
+#include "benchmark.h"
+
+#include "../progmem.h"
+
+namespace test13
+{
+	// A screen's worth of repetitive tile data
+	constexpr uint8_t raw_data[] PROGMEM =
+	{
+		0x00, 0x81, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3C, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+		0x81, 0x00, 0x3C, 0xFF, 0x00, 0x3C, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x81, 0x00,
+		0xFF, 0x3C, 0x00, 0xFF, 0x3C, 0x00, 0x81, 0x00, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x3C, 0x00,
+		0xFF, 0x00, 0x00, 0xFF, 0x81, 0x3C, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x3C,
+		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+		0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+		0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+		0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+		0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+		0x81, 0xFF, 0x81, 0x3C, 0x00, 0x00, 0x00, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0x00, 0xFF, 0x00, 0x3C,
+		0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x81, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0xFF, 0x3C, 0x81, 0x00, 0x00,
+		0x81, 0xFF, 0x00, 0xFF, 0x3C, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x81, 0x81, 0x81, 0xFF, 0x3C, 0x00,
+		0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x81, 0x00, 0xFF, 0x81, 0x00, 0x81, 0x00, 0xFF, 0x00, 0x3C,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+		0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+		0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+		0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+		0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+		0x81, 0x81, 0x3C, 0x00, 0xFF, 0x3C, 0x81, 0x00, 0x81, 0x81, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x81,
+		0x81, 0x00, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x81, 0x81, 0x81, 0x81, 0x00, 0xFF, 0x81,
+		0x00, 0x00, 0x3C, 0x00, 0x81, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xFF,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x3C,
+		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+		0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+		0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+		0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+		0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+		0x00, 0x3C, 0x3C, 0x00, 0xFF, 0x3C, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+		0x00, 0x00, 0x00, 0x3C, 0x81, 0x00, 0x81, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x00,
+		0xFF, 0x3C, 0x81, 0x3C, 0xFF, 0x81, 0x00, 0x3C, 0x3C, 0x81, 0xFF, 0x00, 0x81, 0x3C, 0x00, 0xFF,
+		0x3C, 0x81, 0x00, 0x3C, 0x3C, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+		0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+		0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+		0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+		0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+		0x00, 0x3C, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0xFF, 0x00, 0x3C,
+		0x81, 0x81, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x81, 0x3C, 0xFF, 0x81, 0x00, 0xFF, 0x00, 0x3C,
+		0xFF, 0x00, 0x81, 0xFF, 0x00, 0x00, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00,
+		0xFF, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0x81, 0x00, 0x3C, 0x81, 0xFF, 0x81, 0x00, 0x00, 0x3C, 0x00,
+		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+		0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+		0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+		0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+		0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+		0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x81, 0x3C, 0xFF, 0x00, 0x81, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
+		0x00, 0x81, 0x81, 0xFF, 0x00, 0x81, 0x81, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x00,
+		0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x3C, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x81,
+	};
+
+	// Generated by tools/compress_progmem.py from the data above, with an 8-bit window
+	constexpr uint8_t compressed_data[] PROGMEM =
+	{
+		0x00, 0x04, 0xFF, 0x00, 0x81, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xB3, 0x3C, 0xFF, 0x06, 0x00,
+		0x08, 0x00, 0x81, 0x00, 0x09, 0x00, 0x3C, 0xFE, 0x15, 0x02, 0x00, 0x00, 0x3C, 0x81, 0x00, 0xFF,
+		0x3C, 0xE0, 0x02, 0x01, 0x07, 0x00, 0x19, 0x00, 0x10, 0x00, 0x23, 0x00, 0x00, 0xFF, 0x81, 0x51,
+		0x3C, 0x09, 0x00, 0x03, 0x01, 0x05, 0x00, 0x08, 0x00, 0x04, 0x09, 0x00, 0x04, 0x55, 0x0A, 0x00,
+		0x04, 0x0B, 0x00, 0x04, 0x0C, 0x00, 0x04, 0x0D, 0x00, 0x04, 0x45, 0x0E, 0x00, 0x04, 0x0F, 0x00,
+		0x04, 0x67, 0x02, 0x00, 0x00, 0x01, 0x00, 0x04, 0x55, 0x02, 0x00, 0x04, 0x03, 0x00, 0x04, 0x04,
+		0x00, 0x04, 0x05, 0x00, 0x04, 0x55, 0x06, 0x00, 0x04, 0x07, 0x00, 0x04, 0x81, 0x8D, 0x02, 0x00,
+		0x06, 0x00, 0x50, 0xA0, 0x00, 0xB9, 0x00, 0xC9, 0x00, 0x0D, 0x00, 0x3C, 0x9E, 0x01, 0xFF, 0xBE,
+		0x00, 0x18, 0x18, 0x00, 0xC2, 0x02, 0xCB, 0x01, 0x81, 0x81, 0x1B, 0x02, 0x2D, 0x01, 0x2A, 0x00,
+		0x01, 0x81, 0xD4, 0x01, 0xC2, 0x00, 0x7F, 0x0F, 0x7F, 0x0F, 0x7F, 0x0F, 0x7F, 0x06, 0xFF, 0x0F,
+		0x08, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x07, 0x81, 0xBE, 0x00, 0xA8, 0x01, 0x92, 0x01, 0x01, 0x00,
+		0x06, 0x06, 0x00, 0x81, 0xFF, 0x08, 0x01, 0x09, 0x00, 0xA5, 0x03, 0xA2, 0x00, 0x08, 0x00, 0xE0,
+		0xB6, 0x01, 0xAB, 0x01, 0x18, 0x00, 0xBF, 0x01, 0xB4, 0x04, 0x81, 0x00, 0x3C, 0x00, 0x7F, 0x0F,
+		0x7F, 0x0F, 0x7F, 0x0F, 0x7F, 0x07, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x07, 0x0B, 0x00,
+		0x3C, 0xBF, 0x01, 0x00, 0xB3, 0x00, 0x9C, 0x01, 0x9E, 0x02, 0xCD, 0x01, 0x68, 0x0E, 0x03, 0xB2,
+		0x00, 0xDB, 0x00, 0x3C, 0xC5, 0x00, 0x3C, 0x3C, 0x12, 0x00, 0x0E, 0xEA, 0x04, 0x3C, 0x3C, 0xFF,
+		0xCB, 0x02, 0x00, 0x0A, 0x7F, 0x0F, 0x7F, 0x0F, 0x06, 0x7F, 0x0F, 0x07, 0x07, 0xFF, 0x0F, 0xFF,
+		0x0F, 0xFF, 0x0F, 0xFF, 0x08, 0x93, 0x00, 0x71, 0x81, 0x7F, 0x00, 0xB3, 0x00, 0xB5, 0x01, 0x3C,
+		0x81, 0x81, 0xC4, 0x03, 0x00, 0xB5, 0x02, 0x0F, 0x00, 0xB5, 0x00, 0x0F, 0x00, 0xCF, 0x02, 0x24,
+		0x01, 0xD4, 0x04, 0xC4, 0x00, 0x0D, 0x81, 0x36, 0x01, 0x3C, 0x00, 0x7F, 0x0F, 0x7F, 0x0F, 0x7F,
+		0x0F, 0x7F, 0x08, 0x20, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x06, 0x96, 0x04, 0x00, 0xB7,
+		0x00, 0x00, 0x03, 0x04, 0xB8, 0x00, 0x0C, 0x03, 0xFF, 0xC8, 0x04, 0xBB, 0x00, 0x0F, 0x00, 0x1E,
+		0x02, 0xDC, 0x05, 0x00, 0x24, 0x00, 0xC9, 0x02, 0x08, 0x00,
+	};
+
+	constexpr size_t window_size = 256;
+	constexpr uint8_t iterations = 10;
+
+	void test(Arduboy2 & arduboy)
+	{
+		uint8_t row[128];
+
+		// Verify the decompressed data, one row at a time
+		{
+			progmem::CompressedStream<window_size> stream(compressed_data);
+
+			bool matches = (stream.available() == sizeof(raw_data));
+
+			for(size_t offset = 0; offset < sizeof(raw_data); offset += sizeof(row))
+			{
+				const size_t count = stream.read(row, sizeof(row));
+
+				matches = matches && (count == sizeof(row)) && (memcmp_P(row, &raw_data[offset], count) == 0);
+			}
+
+			arduboy.println(matches);
+			arduboy.println(stream.read());
+		}
+
+		// Verify the iterator interface
+		{
+			progmem::CompressedStream<window_size> stream(compressed_data);
+
+			size_t index = 0;
+			bool matches = true;
+
+			for(auto value : stream)
+			{
+				matches = matches && (value == pgm_read_byte(&raw_data[index]));
+				++index;
+			}
+
+			arduboy.println(matches && (index == sizeof(raw_data)));
+		}
+
+		arduboy.print(sizeof(raw_data));
+		arduboy.print(' ');
+		arduboy.println(sizeof(compressed_data));
+
+		tests::benchmark(arduboy, F("memcpy_P"), iterations, [&](uint16_t)
+		{
+			for(size_t offset = 0; offset < sizeof(raw_data); offset += sizeof(row))
+				memcpy_P(row, &raw_data[offset], sizeof(row));
+
+			return row[0];
+		});
+
+		tests::benchmark(arduboy, F("lzss"), iterations, [&](uint16_t)
+		{
+			progmem::CompressedStream<window_size> stream(compressed_data);
+
+			while(!stream.empty())
+				stream.read(row, sizeof(row));
+
+			return row[0];
+		});
+	}
+}
\ No newline at end of file
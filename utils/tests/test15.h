@@ -0,0 +1,139 @@
+#include <Arduboy2.h>
+
+#include "benchmark.h"
+
+#include "../progmem.h"
+
+namespace test15
+{
+	struct Enemy
+	{
+		int16_t x;
+		int16_t y;
+		uint8_t speed;
+		uint8_t health;
+	};
+
+	constexpr Enemy enemies[] PROGMEM =
+	{
+		{ 0, 0, 1, 10 },
+		{ 8, 37, 2, 11 },
+		{ 16, 10, 3, 12 },
+		{ 24, 47, 4, 13 },
+		{ 32, 20, 1, 14 },
+		{ 40, 57, 2, 15 },
+		{ 48, 30, 3, 16 },
+		{ 56, 3, 4, 10 },
+		{ 64, 40, 1, 11 },
+		{ 72, 13, 2, 12 },
+		{ 80, 50, 3, 13 },
+		{ 88, 23, 4, 14 },
+		{ 96, 60, 1, 15 },
+		{ 104, 33, 2, 16 },
+		{ 112, 6, 3, 10 },
+		{ 120, 43, 4, 11 },
+		{ 128, 16, 1, 12 },
+		{ 136, 53, 2, 13 },
+		{ 144, 26, 3, 14 },
+		{ 152, 63, 4, 15 },
+		{ 160, 36, 1, 16 },
+		{ 168, 9, 2, 10 },
+		{ 176, 46, 3, 11 },
+		{ 184, 19, 4, 12 },
+		{ 192, 56, 1, 13 },
+		{ 200, 29, 2, 14 },
+		{ 208, 2, 3, 15 },
+		{ 216, 39, 4, 16 },
+		{ 224, 12, 1, 10 },
+		{ 232, 49, 2, 11 },
+		{ 240, 22, 3, 12 },
+		{ 248, 59, 4, 13 },
+	};
+
+	constexpr uint8_t iterations = 10;
+
+	// The number of elements read from progmem by the unbuffered sum
+	uint16_t reads = 0;
+
+	// Counts each element read from progmem
+	Enemy readEnemy(progmem::ProgmemReference<Enemy> enemy)
+	{
+		++reads;
+		return enemy;
+	}
+
+	// Counts the chunks read by a buffered range.
+	// Every chunk is read into the start of the range's buffer,
+	// so each element that is dereferenced there began a new chunk.
+	uint16_t countChunks()
+	{
+		auto range = progmem::makeBufferedRange<8>(enemies);
+
+		const Enemy * const buffer = &*range.begin();
+
+		uint16_t chunks = 0;
+
+		for(const Enemy & enemy : range)
+			if(&enemy == buffer)
+				++chunks;
+
+		return chunks;
+	}
+
+	// Each field access copies the whole element from progmem
+	int32_t sumUnbuffered()
+	{
+		int32_t sum = 0;
+
+		for(auto enemy : progmem::makeProgmemArray(enemies))
+			sum += readEnemy(enemy).x + readEnemy(enemy).y + readEnemy(enemy).speed + readEnemy(enemy).health;
+
+		return sum;
+	}
+
+	// Elements are copied from progmem eight at a time
+	int32_t sumBuffered()
+	{
+		int32_t sum = 0;
+
+		for(const Enemy & enemy : progmem::makeBufferedRange<8>(enemies))
+			sum += enemy.x + enemy.y + enemy.speed + enemy.health;
+
+		return sum;
+	}
+
+	void test(Arduboy2 & arduboy)
+	{
+		// One copy per field access versus one copy per chunk
+		reads = 0;
+		sumUnbuffered();
+		arduboy.print(reads);
+		arduboy.print(' ');
+
+		arduboy.println(countChunks());
+
+		// The iterators don't hold a buffer, only the range does
+		arduboy.print(sizeof(progmem::BufferedRange<Enemy, 8>::iterator));
+		arduboy.print(' ');
+		arduboy.println(sizeof(progmem::BufferedRange<Enemy, 8>));
+
+		arduboy.println(tests::benchmark(arduboy, F("unbuffered"), iterations, [](uint16_t) { return sumUnbuffered(); }));
+		arduboy.println(tests::benchmark(arduboy, F("buffered"), iterations, [](uint16_t) { return sumBuffered(); }));
+
+		// A chunk size that doesn't divide the array size
+		int32_t sum = 0;
+		size_t count = 0;
+
+		auto range = progmem::makeBufferedRange<5>(enemies);
+
+		for(auto iterator = range.begin(); iterator.base() != progmem::makeProgmemArray(enemies).end(); ++iterator)
+		{
+			sum += iterator->x + iterator->y + iterator->speed + iterator->health;
+			++count;
+		}
+
+		arduboy.print(count);
+		arduboy.print(' ');
+		arduboy.println(sum == sumUnbuffered());
+	}
+}
\ No newline at end of file
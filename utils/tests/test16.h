@@ -0,0 +1,64 @@
+#include <Arduboy2.h>
+
+#include "benchmark.h"
+
+#include "../progmem.h"
+
+namespace test16
+{
+	struct Enemy
+	{
+		char name[12];
+		int16_t x;
+		int16_t y;
+		uint8_t speed;
+		uint8_t health;
+	};
+
+	constexpr Enemy enemies[] PROGMEM =
+	{
+		{ "Slime", 0, 0, 1, 5 },
+		{ "Bat", 16, 8, 2, 6 },
+		{ "Goblin", 32, 16, 3, 7 },
+		{ "Skeleton", 48, 24, 4, 8 },
+		{ "Ghost", 64, 32, 1, 9 },
+		{ "Wolf", 80, 40, 2, 10 },
+		{ "Spider", 96, 48, 3, 11 },
+		{ "Orc", 112, 56, 4, 12 },
+	};
+
+	constexpr uint16_t iterations = 100;
+
+	void test(Arduboy2 & arduboy)
+	{
+		const auto array = progmem::makeProgmemArray(enemies);
+
+		// Copies all 18 bytes of each enemy
+		arduboy.println(tests::benchmark(arduboy, F("whole"), iterations, [&](uint16_t)
+		{
+			uint16_t sum = 0;
+
+			for(size_t index = 0; index < array.size(); ++index)
+				sum += static_cast<Enemy>(array[index]).speed;
+
+			return sum;
+		}));
+
+		// Reads a single byte of each enemy
+		arduboy.println(tests::benchmark(arduboy, F("member"), iterations, [&](uint16_t)
+		{
+			uint16_t sum = 0;
+
+			for(size_t index = 0; index < array.size(); ++index)
+				sum += array[index].member(&Enemy::speed);
+
+			return sum;
+		}));
+
+		// Through a pointer
+		const auto pointer = array.data();
+
+		arduboy.println(static_cast<int16_t>((pointer + 3)->*&Enemy::x));
+		arduboy.println(static_cast<uint8_t>((pointer + 3).member(&Enemy::health)));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include <Arduboy2.h>
+
+#include "../progmem.h"
+
+namespace test17
+{
+	// On an Arduboy every address is below 64KB,
+	// so these are near addresses read through the far types
+	struct Sprite
+	{
+		uint8_t width;
+		uint8_t height;
+		uint16_t frames;
+	};
+
+	constexpr uint16_t far_words[] PROGMEM = { 1, 10, 100, 1000, 10000 };
+	constexpr Sprite far_sprites[] PROGMEM = { { 8, 8, 1 }, { 16, 16, 4 }, { 32, 8, 2 } };
+	constexpr char far_title[] PROGMEM = "Far away";
+
+	void test(Arduboy2 & arduboy)
+	{
+		const progmem::ProgmemFarArray<uint16_t, utils::size(far_words)> words(pgm_get_far_address(far_words));
+		const progmem::ProgmemFarArray<Sprite, utils::size(far_sprites)> sprites(pgm_get_far_address(far_sprites));
+		const progmem::ProgmemFarString title(pgm_get_far_address(far_title));
+
+		uint16_t sum = 0;
+
+		for(uint16_t word : words)
+			sum += word;
+
+		arduboy.println(sum);
+		arduboy.println(words.back());
+
+		const Sprite sprite = sprites[1];
+
+		arduboy.print(sprite.width);
+		arduboy.print(' ');
+		arduboy.print(sprite.height);
+		arduboy.print(' ');
+		arduboy.println(sprite.frames);
+
+		arduboy.println(sprites.end() - sprites.begin());
+
+		char buffer[16];
+		buffer[title.copy(buffer, sizeof(buffer) - 1)] = '\0';
+
+		arduboy.println(buffer);
+		arduboy.print(title.size());
+		arduboy.print(' ');
+		arduboy.println(title.length());
+		arduboy.println(title == "Far away");
+		arduboy.println(title != "Far");
+		arduboy.println(title[4]);
+	}
+}
\ No newline at end of file
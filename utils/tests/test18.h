@@ -0,0 +1,43 @@
+#include <Arduboy2.h>
+
+#include "../progmem.h"
+#include "../eeprom.h"
+
+namespace test18
+{
+	constexpr uint16_t table[] PROGMEM = { 1, 2, 3, 5, 8, 13, 21, 34, 55, 89 };
+
+	// An array located 16 bytes into eeprom
+	uint8_t (& eeprom_bytes)[8] = *reinterpret_cast<uint8_t (*)[8]>(16);
+
+	template<typename Array>
+	void printArray(Arduboy2 & arduboy, const Array & array)
+	{
+		for(auto value : array)
+		{
+			arduboy.print(value);
+			arduboy.print(' ');
+		}
+
+		arduboy.println();
+	}
+
+	void test(Arduboy2 & arduboy)
+	{
+		// The whole table, with one memcpy_P
+		const auto all = progmem::readProgmem(table);
+		printArray(arduboy, all);
+
+		// Only the middle four elements
+		const auto middle = progmem::readProgmem<3, 4>(table);
+		printArray(arduboy, middle);
+
+		// The same, from eeprom
+		const uint8_t values[8] = { 10, 20, 30, 40, 50, 60, 70, 80 };
+
+		eeprom::writeEeprom(eeprom_bytes, values);
+
+		printArray(arduboy, eeprom::readEeprom(eeprom_bytes));
+		printArray(arduboy, eeprom::readEeprom<6, 2>(eeprom_bytes));
+	}
+}
\ No newline at end of file
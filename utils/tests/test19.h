@@ -0,0 +1,77 @@
+#include <Arduboy2.h>
+
+#include "benchmark.h"
+
+// For sin
+#include <math.h>
+
+#include "../progmem.h"
+
+namespace test19
+{
+	// A Taylor series, since sin isn't constexpr
+	constexpr double sineSeries(double x, double term, uint8_t index)
+	{
+		return (index == 12) ? 0 : (term + sineSeries(x, -term * x * x / ((2 * index + 2) * (2 * index + 3)), index + 1));
+	}
+
+	constexpr double roundToNearest(double value)
+	{
+		return (value >= 0) ? (value + 0.5) : (value - 0.5);
+	}
+
+	// sin(2π * phase / 1024), scaled to 16384
+	struct Sine
+	{
+		constexpr int16_t operator()(size_t phase) const
+		{
+			return static_cast<int16_t>(roundToNearest(sineSeries(6.283185307179586 * phase / 1024, 6.283185307179586 * phase / 1024, 0) * 16384));
+		}
+	};
+
+	// A gamma of 2
+	struct Gamma
+	{
+		constexpr uint8_t operator()(size_t index) const
+		{
+			return static_cast<uint8_t>(((index * index) + 127) / 255);
+		}
+	};
+
+	using SineTable = progmem::QuarterWaveTable<int16_t, 256, Sine>;
+	using GammaTable = progmem::LookupTable<uint8_t, 256, Gamma>;
+
+	constexpr uint16_t iterations = 100;
+
+	void test(Arduboy2 & arduboy)
+	{
+		// The peaks and zero crossings of each quarter
+		for(uint16_t phase = 0; phase < SineTable::period; phase += 128)
+		{
+			arduboy.print(SineTable::get(phase));
+			arduboy.print(' ');
+		}
+
+		arduboy.println();
+
+		// Halfway between phases 1 and 2, with 4 fractional bits
+		arduboy.print(SineTable::get(1));
+		arduboy.print(' ');
+		arduboy.print(SineTable::interpolate<4>(0x18));
+		arduboy.print(' ');
+		arduboy.println(SineTable::get(2));
+
+		// Through a ProgmemArray
+		const auto gamma = GammaTable::array();
+
+		arduboy.print(gamma[128]);
+		arduboy.print(' ');
+		arduboy.print(GammaTable::interpolate<8>(0x8080));
+		arduboy.print(' ');
+		arduboy.println(GammaTable::get(255));
+
+		tests::benchmark(arduboy, F("sin"), iterations, [](uint16_t index) { return static_cast<int16_t>(sin(index * (6.283185307179586 / 1024)) * 16384); });
+		tests::benchmark(arduboy, F("table"), iterations, [](uint16_t index) { return SineTable::get(index); });
+		tests::benchmark(arduboy, F("lerp"), iterations, [](uint16_t index) { return SineTable::interpolate<4>(index * 16 + 7); });
+	}
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include <Arduboy2.h>
+
+#include "../progmem.h"
+#include "../eeprom.h"
+
+namespace test20
+{
+	// A power-of-two width, so rows are found with a shift
+	constexpr uint8_t tiles[3][8] PROGMEM
+	{
+		{ 0, 1, 2, 3, 4, 5, 6, 7 },
+		{ 10, 11, 12, 13, 14, 15, 16, 17 },
+		{ 20, 21, 22, 23, 24, 25, 26, 27 },
+	};
+
+	// A width that isn't a power of two
+	constexpr uint16_t costs[2][3] PROGMEM
+	{
+		{ 100, 200, 300 },
+		{ 400, 500, 600 },
+	};
+
+	// A 4x2 grid located 32 bytes into eeprom
+	uint8_t (& eeprom_scores)[2][4] = *reinterpret_cast<uint8_t (*)[2][4]>(32);
+
+	template<typename Range>
+	void printRange(Arduboy2 & arduboy, const Range & range)
+	{
+		for(auto value : range)
+		{
+			arduboy.print(value);
+			arduboy.print(' ');
+		}
+
+		arduboy.println();
+	}
+
+	void test(Arduboy2 & arduboy)
+	{
+		constexpr auto tileGrid = progmem::makeProgmemGrid(tiles);
+
+		arduboy.println(tileGrid(5, 2));
+		printRange(arduboy, tileGrid.row(1));
+		printRange(arduboy, tileGrid.column(3));
+
+		constexpr progmem::ProgmemGrid<uint16_t, 3, 2> costGrid(costs);
+
+		arduboy.println(costGrid(2, 1));
+		printRange(arduboy, costGrid.column(1));
+		printRange(arduboy, costGrid);
+
+		auto scoreGrid = eeprom::makeEepromGrid(eeprom_scores);
+
+		for(uint8_t y = 0; y < scoreGrid.height(); ++y)
+			for(uint8_t x = 0; x < scoreGrid.width(); ++x)
+				scoreGrid(x, y) = static_cast<uint8_t>((y * 10) + x);
+
+		arduboy.println(static_cast<uint8_t>(scoreGrid(3, 1)));
+		printRange(arduboy, scoreGrid.row(1));
+		printRange(arduboy, scoreGrid.column(2));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <Arduboy2.h>
+
+#include "benchmark.h"
+
+#include "../progmem.h"
+
+namespace test21
+{
+	struct Item
+	{
+		uint8_t id;
+		uint8_t price;
+		char name[6];
+	};
+
+	constexpr Item items[] PROGMEM =
+	{
+		{ 2, 10, "Sword" },
+		{ 3, 15, "Bow" },
+		{ 5, 25, "Staff" },
+		{ 8, 5, "Rope" },
+		{ 13, 50, "Ring" },
+		{ 21, 1, "Apple" },
+	};
+
+	static_assert(progmem::isSorted(items, &Item::id), "items must be sorted by id");
+
+	// Multiples of three, enough to use the branchless search
+	struct Multiples
+	{
+		constexpr uint16_t operator()(size_t index) const
+		{
+			return static_cast<uint16_t>(index * 3);
+		}
+	};
+
+	using Table = progmem::LookupTable<uint16_t, 512, Multiples>;
+
+	static_assert(progmem::isSorted(Table::values.values), "the table must be sorted");
+
+	constexpr uint8_t unsorted[] { 1, 2, 4, 3 };
+
+	static_assert(!progmem::isSorted(unsorted), "isSorted must detect an unsorted array");
+
+	constexpr uint16_t iterations = 100;
+
+	// Spreads the searched keys across the table
+	uint16_t searchKey(uint16_t index)
+	{
+		return static_cast<uint16_t>((index * 31) % 1536);
+	}
+
+	size_t linearSearch(uint16_t key)
+	{
+		const auto table = Table::array();
+
+		for(size_t index = 0; index < table.size(); ++index)
+			if(table[index] >= key)
+				return index;
+
+		return table.size();
+	}
+
+	size_t tableSearch(uint16_t key)
+	{
+		const auto table = Table::array();
+
+		return static_cast<size_t>(progmem::lowerBound(table, key) - table.begin());
+	}
+
+	void test(Arduboy2 & arduboy)
+	{
+		const auto itemArray = progmem::makeProgmemArray(items);
+
+		// Only the id of each probed item is read
+		const auto found = progmem::lowerBound(itemArray, 13, &Item::id);
+		arduboy.println(static_cast<uint8_t>(found.member(&Item::price)));
+
+		arduboy.print(progmem::lowerBound(itemArray, 4, &Item::id) - itemArray.begin());
+		arduboy.print(' ');
+		arduboy.print(progmem::upperBound(itemArray, 5, &Item::id) - itemArray.begin());
+		arduboy.print(' ');
+		arduboy.print(progmem::binarySearch(itemArray, 8, &Item::id));
+		arduboy.print(' ');
+		arduboy.println(progmem::binarySearch(itemArray, 9, &Item::id));
+
+		// Check every key against the linear scan, including keys past the end
+		const auto table = Table::array();
+
+		bool matches = true;
+
+		for(uint16_t key = 0; key < 1540; ++key)
+		{
+			if(tableSearch(key) != linearSearch(key))
+				matches = false;
+
+			const auto upper = progmem::upperBound(table, key);
+
+			if((upper != table.end()) && (static_cast<uint16_t>(*upper) <= key))
+				matches = false;
+
+			if(progmem::binarySearch(table, key) != ((key % 3) == 0 && key < 1536))
+				matches = false;
+		}
+
+		arduboy.println(matches);
+
+		// Summed so that every search contributes to the result
+		uint32_t linearTotal = 0;
+		uint32_t binaryTotal = 0;
+
+		arduboy.println(tests::benchmark(arduboy, F("linear"), iterations, [&](uint16_t index) { return linearTotal += linearSearch(searchKey(index)); }));
+		arduboy.println(tests::benchmark(arduboy, F("binary"), iterations, [&](uint16_t index) { return binaryTotal += tableSearch(searchKey(index)); }));
+	}
+}
\ No newline at end of file
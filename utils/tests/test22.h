@@ -0,0 +1,64 @@
+#include <Arduboy2.h>
+
+#include "../progmem.h"
+
+namespace test22
+{
+	// Forwards to another Print, recording the deepest stack address reached
+	class StackProbe :
+		public Print
+	{
+	private:
+		Print & output;
+		uintptr_t lowest;
+
+	public:
+		StackProbe(Print & output, uintptr_t start) :
+			output(output), lowest(start)
+		{
+		}
+
+		size_t write(uint8_t value) override
+		{
+			volatile uint8_t marker = 0;
+
+			const uintptr_t address = reinterpret_cast<uintptr_t>(&marker);
+
+			if(address < this->lowest)
+				this->lowest = address;
+
+			return this->output.write(value);
+		}
+
+		uintptr_t getLowest() const
+		{
+			return this->lowest;
+		}
+	};
+
+	constexpr char name[] PROGMEM = "Arduboy";
+
+	void test(Arduboy2 & arduboy)
+	{
+		progmem::format(arduboy, PROGMEM_STRING("HP {:3}/{} ${:.2} 0x{:04X}\n"), 42, 100, 1205, 255);
+		progmem::format(arduboy, PROGMEM_STRING("[{:<6}] [{:6}] [{:.3}]\n"), "left", "right", "truncated");
+		progmem::format(arduboy, PROGMEM_STRING("[{}] [{:05}] [{:.3}] [{:x}]\n"), -1234, -42, -5, 0xBEEFul);
+		progmem::format(arduboy, PROGMEM_STRING("{} {} {} {{}}\n"), 'c', static_cast<uint8_t>(200), static_cast<int8_t>(-100));
+		progmem::format(arduboy, PROGMEM_STRING("{} {} {}\n"), -2147483647l - 1, 4294967295ul, progmem::ProgmemString(name));
+		progmem::format(arduboy, F("{:8}|{}|\n"), F("flash"));
+
+		// The number of characters written
+		arduboy.println(progmem::format(arduboy, PROGMEM_STRING("{:.2}\n"), 7));
+
+		// Stack used by a call with four arguments, including the Print call itself
+		volatile uint8_t marker = 0;
+
+		const uintptr_t start = reinterpret_cast<uintptr_t>(&marker);
+
+		StackProbe probe(arduboy, start);
+
+		progmem::format(probe, PROGMEM_STRING("{:3} {:.2} {:04X} {}\n"), 42, 1205, 255, "text");
+
+		arduboy.println(start - probe.getLowest());
+	}
+}
\ No newline at end of file
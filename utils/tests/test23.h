@@ -0,0 +1,76 @@
+#include <Arduboy2.h>
+
+#include "../eeprom.h"
+
+namespace test23
+{
+	struct Settings
+	{
+		uint8_t volume;
+		uint8_t brightness;
+		uint16_t highScore;
+		char name[4];
+	};
+
+	// Settings located 64 bytes into eeprom
+	Settings & settings = *reinterpret_cast<Settings *>(64);
+
+	void printSettings(Arduboy2 & arduboy, const Settings & value)
+	{
+		arduboy.print(value.volume);
+		arduboy.print(' ');
+		arduboy.print(value.brightness);
+		arduboy.print(' ');
+		arduboy.print(value.highScore);
+		arduboy.print(' ');
+		arduboy.println(value.name[0]);
+	}
+
+	void test(Arduboy2 & arduboy)
+	{
+		eeprom::writeEeprom(settings, Settings { 1, 2, 3, { 'A', 'B', 'C', '\0' } });
+
+		eeprom::EepromCache<sizeof(Settings)> cache(&settings);
+
+		auto volume = cache.bind(eeprom::makeEepromReference(settings.volume));
+		auto highScore = cache.bind(eeprom::makeEepromReference(settings.highScore));
+		auto name = cache.bind(eeprom::makeEepromArray(settings.name));
+
+		volume = 7;
+		highScore = 1000;
+		name[0] = 'Z';
+
+		// Writing an unchanged value marks nothing dirty
+		name[1] = 'B';
+
+		// Eeprom is unchanged until the cache is flushed
+		printSettings(arduboy, eeprom::readEeprom(settings));
+		arduboy.print(static_cast<uint8_t>(volume));
+		arduboy.print(' ');
+		arduboy.println(static_cast<uint16_t>(highScore));
+
+		// 1000 differs from 3 in both bytes, so four bytes are dirty
+		arduboy.print(cache.flush_some(2));
+		arduboy.print(' ');
+		arduboy.print(cache.dirty());
+		arduboy.print(' ');
+		arduboy.print(cache.flush_some(2));
+		arduboy.print(' ');
+		arduboy.println(cache.dirty());
+
+		printSettings(arduboy, eeprom::readEeprom(settings));
+
+		// Four-byte lines, so the whole of the first line is written
+		eeprom::EepromCache<sizeof(Settings), 4> lineCache(&settings);
+
+		lineCache.bind(eeprom::makeEepromReference(settings.brightness)) = 9;
+
+		arduboy.print(lineCache.dirty());
+		arduboy.print(' ');
+		arduboy.print(lineCache.flush());
+		arduboy.print(' ');
+		arduboy.println(lineCache.flush());
+
+		printSettings(arduboy, eeprom::readEeprom(settings));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include <Arduboy2.h>
+
+#include "benchmark.h"
+
+#include "../eeprom.h"
+
+EEPROM_ASYNC_WRITE_INTERRUPT
+
+namespace test24
+{
+	struct Save
+	{
+		uint16_t level;
+		uint32_t score;
+		uint8_t lives;
+	};
+
+	// A save located 96 bytes into eeprom
+	Save & save = *reinterpret_cast<Save *>(96);
+
+	volatile bool completed = false;
+
+	void onComplete()
+	{
+		completed = true;
+	}
+
+	void printSave(Arduboy2 & arduboy, const Save & value)
+	{
+		arduboy.print(value.level);
+		arduboy.print(' ');
+		arduboy.print(value.score);
+		arduboy.print(' ');
+		arduboy.println(value.lives);
+	}
+
+	void test(Arduboy2 & arduboy)
+	{
+		eeprom::writeEeprom(save, Save { 1, 0, 3 });
+
+		eeprom::setAsyncWriteCallback(onComplete);
+
+		// Queuing returns long before the bytes are written
+		tests::benchmark(arduboy, F("queue"), 1, [](uint16_t)
+		{
+			eeprom::asyncWrite(save, Save { 2, 123456, 3 });
+			return eeprom::asyncPending();
+		});
+
+		arduboy.print(eeprom::asyncPending() > 0);
+		arduboy.print(' ');
+		arduboy.println(eeprom::asyncComplete());
+
+		// Queued writes are visible before they are made
+		printSave(arduboy, eeprom::asyncRead(save));
+
+		tests::benchmark(arduboy, F("flush"), 1, [](uint16_t)
+		{
+			eeprom::asyncFlush();
+			return eeprom::asyncComplete();
+		});
+
+		arduboy.print(eeprom::asyncPending());
+		arduboy.print(' ');
+		arduboy.print(eeprom::asyncComplete());
+		arduboy.print(' ');
+		arduboy.println(completed);
+
+		printSave(arduboy, eeprom::readEeprom(save));
+
+		eeprom::setAsyncWriteCallback(nullptr);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include <Arduboy2.h>
+
+#include "../eeprom.h"
+
+namespace test25
+{
+	using HighScore = eeprom::WearLevelled<uint16_t, 4>;
+
+	// A ring located 128 bytes into eeprom
+	HighScore::storage_type & storage = *reinterpret_cast<HighScore::storage_type *>(128);
+
+	void test(Arduboy2 & arduboy)
+	{
+		// Start from erased eeprom
+		const HighScore::slot_type erased { 0xFF, 0xFFFF };
+
+		for(auto & slot : storage)
+			eeprom::writeEeprom(slot, erased);
+
+		HighScore highScore(storage);
+
+		for(uint16_t score = 100; score <= 600; score += 100)
+		{
+			highScore = score;
+
+			arduboy.print(highScore.slot());
+			arduboy.print(' ');
+			arduboy.println(static_cast<uint16_t>(highScore));
+		}
+
+		// An identical value isn't written
+		highScore = 600;
+		arduboy.println(highScore.slot());
+
+		// Finding the latest slot again, as at boot
+		HighScore rebooted(storage);
+		arduboy.print(rebooted.slot());
+		arduboy.print(' ');
+		arduboy.println(static_cast<uint16_t>(rebooted));
+
+		// Power lost after writing the value, but before the sequence number
+		eeprom::writeEeprom(storage[3].value, static_cast<uint16_t>(700));
+
+		HighScore interrupted(storage);
+		arduboy.print(interrupted.slot());
+		arduboy.print(' ');
+		arduboy.println(static_cast<uint16_t>(interrupted));
+
+		// Written every 5 seconds for 2 hours a day
+		arduboy.print(HighScore::lifetime_writes());
+		arduboy.print(' ');
+		arduboy.println(HighScore::lifetime_days(1440));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <Arduboy2.h>
+
+#include "../eeprom.h"
+
+#include "powerLoss.h"
+
+namespace test26
+{
+	struct Save
+	{
+		uint8_t level;
+		uint16_t coins;
+		uint32_t score;
+	};
+
+	using SaveData = eeprom::Transactional<Save>;
+
+	// Two slots located 160 bytes into eeprom
+	SaveData::storage_type & storage = *reinterpret_cast<SaveData::storage_type *>(160);
+
+	bool equals(const Save & left, const Save & right)
+	{
+		return (left.level == right.level) && (left.coins == right.coins) && (left.score == right.score);
+	}
+
+	void test(Arduboy2 & arduboy)
+	{
+		// The standard check value for CRC-16/CCITT-FALSE is 0x29B1
+		const char check[] = "123456789";
+		arduboy.println(eeprom::details::crc16(check, 9), 16);
+
+		// Start from erased eeprom
+		const SaveData::slot_type erased { 0xFFFF, { 0xFF, 0xFFFF, 0xFFFFFFFF }, 0xFFFF };
+
+		eeprom::writeEeprom(storage[0], erased);
+		eeprom::writeEeprom(storage[1], erased);
+
+		SaveData saveData(storage);
+
+		Save loaded {};
+		arduboy.println(saveData.load(loaded));
+
+		const Save oldSave { 1, 10, 100 };
+		const Save newSave { 2, 20, 200 };
+
+		saveData.commit(oldSave);
+		saveData.commit(newSave);
+		saveData.commit(oldSave);
+
+		arduboy.print(saveData.generation());
+		arduboy.print(' ');
+		arduboy.println(saveData.slot());
+
+		// Lose power after each byte written by commit in turn,
+		// until a commit completes without losing power
+		using TestData = eeprom::Transactional<Save, tests::PowerLossWriter>;
+
+		const Save nextSave { 3, 3000, 300000 };
+
+		const SaveData::slot_type before = eeprom::readEeprom(storage[1]);
+
+		uint16_t cuts = 0;
+		uint8_t failures = 0;
+
+		for(uint16_t budget = 0; true; ++budget)
+		{
+			eeprom::writeEeprom(storage[1], before);
+
+			TestData interrupted(storage);
+
+			tests::PowerLossWriter::cutAfter(budget);
+			interrupted.commit(nextSave);
+			tests::PowerLossWriter::restore();
+
+			SaveData recovered(storage);
+
+			Save value {};
+
+			const bool found = recovered.load(value);
+			// The newest complete save, never a mixture or the stale save in the other slot
+			const bool complete = !tests::PowerLossWriter::lost();
+			const bool intact = complete ? equals(value, nextSave) : equals(value, oldSave);
+
+			if(!found || !intact)
+				++failures;
+
+			if(complete)
+				break;
+
+			++cuts;
+		}
+
+		arduboy.print(cuts);
+		arduboy.print(' ');
+		arduboy.println(failures);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <Arduboy2.h>
+
+#include "../eeprom.h"
+
+namespace test27
+{
+	// 24 bytes located 224 bytes into eeprom
+	uint8_t (& block)[24] = *reinterpret_cast<uint8_t (*)[24]>(224);
+
+	void printStatistics(Arduboy2 & arduboy, const eeprom::WriteStatistics & statistics)
+	{
+		arduboy.print(statistics.compared);
+		arduboy.print(' ');
+		arduboy.print(statistics.written);
+		arduboy.print(' ');
+		arduboy.println(statistics.erased);
+	}
+
+	void test(Arduboy2 & arduboy)
+	{
+		uint8_t values[24];
+
+		for(uint8_t index = 0; index < 24; ++index)
+			values[index] = index;
+
+		eeprom::writeEeprom(block, values);
+
+		// Nothing changed
+		printStatistics(arduboy, eeprom::updateEeprom(block, values));
+
+		// Clearing bits needs no erase, setting to 0xFF needs no write
+		values[1] = 0x00;
+		values[3] = 0x02;
+		values[20] = 0xFF;
+
+		// Setting a bit needs both
+		values[22] = 0x17;
+
+		printStatistics(arduboy, eeprom::updateEeprom(block, values));
+
+		const auto result = eeprom::readEeprom(block);
+
+		arduboy.print(result[1]);
+		arduboy.print(' ');
+		arduboy.print(result[3]);
+		arduboy.print(' ');
+		arduboy.print(result[20]);
+		arduboy.print(' ');
+		arduboy.println(result[22]);
+
+		// With a copy in RAM, eeprom isn't read
+		const auto current = eeprom::readEeprom(block);
+
+		uint8_t shadow[24];
+
+		for(uint8_t index = 0; index < 24; ++index)
+			shadow[index] = current[index];
+
+		eeprom::WriteStatistics total { 0, 0, 0 };
+
+		values[0] = 0xFF;
+		total += eeprom::updateEeprom(block, values, shadow);
+
+		values[0] = 0x80;
+		total += eeprom::updateEeprom(block, values, shadow);
+
+		printStatistics(arduboy, total);
+		arduboy.println(eeprom::readEeprom(block[0]));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include <Arduboy2.h>
+
+#include "../eeprom.h"
+
+namespace test28
+{
+	struct SettingsData
+	{
+		uint8_t volume;
+		uint8_t brightness;
+		bool inverted;
+	};
+
+	struct Settings : eeprom::LayoutField<SettingsData, 1> {};
+	struct HighScores : eeprom::LayoutField<uint16_t[4], 2, 2> {};
+	struct PlayTime : eeprom::LayoutField<uint32_t, 3, 4> {};
+
+	using SaveLayout = eeprom::Layout<256, Settings, HighScores, PlayTime>;
+
+	// A second layout placed directly after the first
+	struct Name : eeprom::LayoutField<char[8], 1> {};
+
+	using ProfileLayout = eeprom::Layout<SaveLayout::end, Name>;
+
+	// The same fields in a different order
+	using ReorderedLayout = eeprom::Layout<256, HighScores, Settings, PlayTime>;
+
+	static_assert(SaveLayout::offset<Settings>() == 260, "Settings follows the hash");
+	static_assert(SaveLayout::offset<HighScores>() == 264, "HighScores is aligned to 2");
+	static_assert(SaveLayout::offset<PlayTime>() == 272, "PlayTime is aligned to 4");
+	static_assert(SaveLayout::hash != ReorderedLayout::hash, "Reordering fields changes the hash");
+
+	// Fields of the same size, which differ only by identifier
+	struct Coins : eeprom::LayoutField<uint16_t, 4> {};
+	struct Gems : eeprom::LayoutField<uint16_t, 5> {};
+	struct SignedCoins : eeprom::LayoutField<int16_t, 6> {};
+
+	static_assert(eeprom::Layout<16, Coins, Gems>::hash != eeprom::Layout<16, Gems, Coins>::hash, "Swapping fields of the same size changes the hash");
+	static_assert(eeprom::Layout<16, Coins, Gems>::hash != eeprom::Layout<16, SignedCoins, Gems>::hash, "Retyping a field with a new identifier changes the hash");
+
+	static_assert(!eeprom::details::layout_distinct<Coins, Gems, Coins>::value, "A field may not appear twice");
+	static_assert(!eeprom::details::layout_distinct<Coins, eeprom::LayoutField<uint8_t, 4>>::value, "Identifiers may not be shared");
+
+	void test(Arduboy2 & arduboy)
+	{
+		arduboy.print(SaveLayout::offset<Settings>());
+		arduboy.print(' ');
+		arduboy.print(SaveLayout::offset<HighScores>());
+		arduboy.print(' ');
+		arduboy.print(SaveLayout::offset<PlayTime>());
+		arduboy.print(' ');
+		arduboy.print(SaveLayout::size);
+		arduboy.print(' ');
+		arduboy.println(ProfileLayout::offset<Name>());
+
+		arduboy.println(SaveLayout::hash, 16);
+
+		// Clear the stored hash, as if eeprom held some other data
+		eeprom::writeEeprom(*reinterpret_cast<uint32_t *>(256), static_cast<uint32_t>(0));
+
+		arduboy.print(SaveLayout::valid());
+
+		if(!SaveLayout::valid())
+		{
+			SaveLayout::get<Settings>() = SettingsData { 5, 3, false };
+
+			auto scores = SaveLayout::get<HighScores>();
+
+			for(uint8_t index = 0; index < scores.size(); ++index)
+				scores[index] = static_cast<uint16_t>(1000 - (index * 100));
+
+			SaveLayout::get<PlayTime>() = 0;
+
+			SaveLayout::stamp();
+		}
+
+		arduboy.print(' ');
+		arduboy.print(SaveLayout::valid());
+		arduboy.print(' ');
+		arduboy.println(ReorderedLayout::valid());
+
+		const SettingsData settings = SaveLayout::get<Settings>();
+		arduboy.print(settings.volume);
+		arduboy.print(' ');
+		arduboy.println(static_cast<uint16_t>(SaveLayout::get<HighScores>()[3]));
+	}
+}
\ No newline at end of file
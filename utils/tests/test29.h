@@ -0,0 +1,162 @@
+#include <Arduboy2.h>
+
+#include "../eeprom.h"
+
+#include "benchmark.h"
+#include "powerLoss.h"
+
+namespace test29
+{
+	// All of eeprom after the 16 bytes reserved by Arduboy2
+	using Store = eeprom::KeyValueStore<1008, 16>;
+
+	void * const region = reinterpret_cast<void *>(16);
+
+	constexpr uint8_t volumeKey = 1;
+	constexpr uint8_t nameKey = 2;
+	constexpr uint8_t scoreKey = 3;
+
+	// A small store for losing power during compaction
+	using SmallStore = eeprom::KeyValueStore<32, 4>;
+	using InterruptedStore = eeprom::KeyValueStore<32, 4, tests::PowerLossWriter>;
+
+	void * const smallRegion = reinterpret_cast<void *>(16);
+
+	// Erases a small store and fills its log, leaving older records to be discarded
+	void fillSmallStore()
+	{
+		uint8_t * const bytes = static_cast<uint8_t *>(smallRegion);
+
+		for(uint8_t index = 0; index < 32; ++index)
+			eeprom_update_byte(&bytes[index], 0xFF);
+
+		SmallStore store(smallRegion);
+		store.clear();
+
+		for(uint8_t index = 0; index < 3; ++index)
+			store.set(volumeKey, index);
+
+		store.set(scoreKey, static_cast<uint16_t>(1234));
+	}
+
+	void test(Arduboy2 & arduboy)
+	{
+		Store store(region);
+		store.clear();
+
+		store.set(volumeKey, static_cast<uint8_t>(5));
+		store.set(nameKey, "PHAR");
+		store.set(scoreKey, static_cast<uint32_t>(1000));
+
+		// Identical values aren't appended
+		const auto used = store.used();
+		store.set(volumeKey, static_cast<uint8_t>(5));
+		arduboy.print(used);
+		arduboy.print(' ');
+		arduboy.println(store.used());
+
+		// Values of the wrong size aren't read
+		uint8_t volume = 0;
+		uint16_t wrongSize = 0;
+		arduboy.print(store.get(volumeKey, volume));
+		arduboy.print(' ');
+		arduboy.print(volume);
+		arduboy.print(' ');
+		arduboy.println(store.get(volumeKey, wrongSize));
+
+		// Fill the log until it has to be compacted
+		uint32_t score = 1000;
+
+		for(uint16_t index = 0; index < 300; ++index)
+			store.set(scoreKey, ++score);
+
+		store.remove(nameKey);
+
+		arduboy.print(store.used());
+		arduboy.print(' ');
+		arduboy.println(store.contains(nameKey));
+
+		// Rebuild the index, as at boot
+		tests::benchmark(arduboy, F("boot"), 1, [&](uint16_t)
+		{
+			Store booted(region);
+			return booted.used();
+		});
+
+		Store rebooted(region);
+
+		uint32_t loadedScore = 0;
+		rebooted.get(scoreKey, loadedScore);
+
+		arduboy.print(loadedScore);
+		arduboy.print(' ');
+		arduboy.print(rebooted.contains(nameKey));
+		arduboy.print(' ');
+		arduboy.println(rebooted.used());
+
+		rebooted.compact();
+		arduboy.println(rebooted.used());
+
+		uint8_t rebootedVolume = 0;
+		rebooted.get(volumeKey, rebootedVolume);
+		rebooted.get(scoreKey, loadedScore);
+		arduboy.print(rebootedVolume);
+		arduboy.print(' ');
+		arduboy.println(loadedScore);
+
+		// Fill the log with the largest number of records, then time the scan.
+		// Each bank holds 503 bytes of records, and each record is 3 bytes, so 167 records fit.
+		rebooted.clear();
+
+		for(uint16_t index = 0; index < 167; ++index)
+			rebooted.set(static_cast<uint8_t>(index % 8), static_cast<uint8_t>(index));
+
+		const auto fullUsed = tests::benchmark(arduboy, F("full"), 1, [&](uint16_t)
+		{
+			Store full(region);
+			return full.used();
+		});
+
+		arduboy.println(fullUsed);
+
+		// Lose power after each byte written by compaction in turn,
+		// until a compaction completes without losing power
+		uint8_t cuts = 0;
+		uint8_t failures = 0;
+
+		for(uint8_t budget = 0; true; ++budget)
+		{
+			fillSmallStore();
+
+			InterruptedStore interrupted(smallRegion);
+
+			tests::PowerLossWriter::cutAfter(budget);
+			interrupted.compact();
+			tests::PowerLossWriter::restore();
+
+			const bool complete = !tests::PowerLossWriter::lost();
+
+			SmallStore recovered(smallRegion);
+
+			uint8_t recoveredVolume = 0;
+			uint16_t recoveredScore = 0;
+
+			const bool intact = recovered.get(volumeKey, recoveredVolume) && (recoveredVolume == 2) && recovered.get(scoreKey, recoveredScore) && (recoveredScore == 1234);
+
+			// Only a complete compaction frees any space
+			const bool expectedSize = complete ? (recovered.used() == 7) : (recovered.used() == 13);
+
+			if(!intact || !expectedSize)
+				++failures;
+
+			if(complete)
+				break;
+
+			++cuts;
+		}
+
+		arduboy.print(cuts);
+		arduboy.print(' ');
+		arduboy.println(failures);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include <Arduboy2.h>
+
+#include "../eeprom.h"
+
+#include "powerLoss.h"
+
+namespace test30
+{
+	struct SaveV1
+	{
+		uint16_t score;
+		uint8_t level;
+		char name[20];
+	};
+
+	struct SaveV2
+	{
+		uint8_t level;
+		uint32_t score;
+		uint8_t lives;
+		char name[20];
+	};
+
+	struct SaveV3
+	{
+		uint8_t level;
+		uint32_t score;
+		uint8_t lives;
+		char name[20];
+		uint16_t coins;
+	};
+
+	// Migrations are templates so that they can also be run through tests::PowerLossWriter
+	struct MigrateToV2
+	{
+		template<typename Migrator>
+		static void migrate(Migrator & migrator)
+		{
+			// Every step leaves the data it still needs intact
+			migrator.move(offsetof(SaveV1, name), offsetof(SaveV2, name), sizeof(SaveV1::name));
+
+			// Park the level in the space reserved for lives
+			migrator.move(offsetof(SaveV1, level), offsetof(SaveV2, lives), sizeof(uint8_t));
+
+			// Widen the score, zeroing its upper bytes
+			migrator.move(offsetof(SaveV1, score), offsetof(SaveV2, score), sizeof(uint16_t));
+			migrator.fill(offsetof(SaveV2, score) + sizeof(uint16_t), sizeof(uint16_t), 0);
+
+			migrator.move(offsetof(SaveV2, lives), offsetof(SaveV2, level), sizeof(uint8_t));
+			migrator.set(offsetof(SaveV2, lives), static_cast<uint8_t>(3));
+		}
+	};
+
+	struct MigrateToV3
+	{
+		template<typename Migrator>
+		static void migrate(Migrator & migrator)
+		{
+			migrator.set(offsetof(SaveV3, coins), static_cast<uint16_t>(0));
+		}
+	};
+
+	using SaveSchema = eeprom::SchemaChain<
+		eeprom::Schema<1, SaveV1>,
+		eeprom::Schema<2, SaveV2, MigrateToV2>,
+		eeprom::Schema<3, SaveV3, MigrateToV3>>;
+
+	// Located 200 bytes into eeprom
+	SaveSchema::storage_type & storage = *reinterpret_cast<SaveSchema::storage_type *>(200);
+
+	const SaveV1 oldSave { 1234, 7, "PHARAP" };
+
+	// Writes the save over erased eeprom, as firmware using only the first schema would have
+	void writeOldSave()
+	{
+		uint8_t * const bytes = reinterpret_cast<uint8_t *>(&storage);
+
+		for(size_t index = 0; index < sizeof(storage); ++index)
+			eeprom_update_byte(&bytes[index], 0xFF);
+
+		using OldSchema = eeprom::SchemaChain<eeprom::Schema<1, SaveV1>>;
+
+		OldSchema::initialise(*reinterpret_cast<OldSchema::storage_type *>(&storage), oldSave);
+	}
+
+	bool upgraded()
+	{
+		const SaveV3 save = SaveSchema::reference(storage);
+
+		return SaveSchema::current(storage) && (save.level == oldSave.level) && (save.score == oldSave.score) &&
+			(save.lives == 3) && (strcmp(save.name, oldSave.name) == 0) && (save.coins == 0);
+	}
+
+	void test(Arduboy2 & arduboy)
+	{
+		// Erased eeprom isn't part of the chain
+		eeprom::updateEeprom(storage.version, static_cast<uint8_t>(0xFF));
+		arduboy.println(SaveSchema::upgrade(storage));
+
+		writeOldSave();
+
+		arduboy.print(SaveSchema::storedVersion(storage));
+		arduboy.print(' ');
+
+		const auto start = micros();
+		const bool result = SaveSchema::upgrade(storage);
+		const auto end = micros();
+
+		arduboy.print(result);
+		arduboy.print(' ');
+		arduboy.print(upgraded());
+		arduboy.print(' ');
+		arduboy.println(end - start);
+
+		// Upgrading again does nothing
+		arduboy.println(SaveSchema::upgrade(storage) && upgraded());
+
+		// Lose power after each byte written by the upgrade in turn,
+		// including partway through each chunk of a move or fill,
+		// until an upgrade completes without losing power
+		uint8_t cuts = 0;
+		uint8_t failures = 0;
+
+		for(uint8_t budget = 0; true; ++budget)
+		{
+			writeOldSave();
+
+			tests::PowerLossWriter::cutAfter(budget);
+			SaveSchema::upgrade<tests::PowerLossWriter>(storage);
+			tests::PowerLossWriter::restore();
+
+			const bool complete = !tests::PowerLossWriter::lost();
+
+			// Resumes the interrupted migration
+			if(!SaveSchema::upgrade(storage) || !upgraded())
+				++failures;
+
+			if(complete)
+				break;
+
+			++cuts;
+		}
+
+		arduboy.print(cuts);
+		arduboy.print(' ');
+		arduboy.print(failures);
+		arduboy.print(' ');
+		arduboy.println(sizeof(eeprom::SchemaMigrator));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <Arduboy2.h>
+
+#include "benchmark.h"
+
+#include "../eeprom.h"
+
+namespace test31
+{
+	struct Save
+	{
+		uint8_t level;
+		uint16_t coins;
+		uint32_t score;
+	};
+
+	// Located 260 bytes into eeprom
+	Save & saveObject = *reinterpret_cast<Save *>(260);
+
+	void test(Arduboy2 & arduboy)
+	{
+		auto save = eeprom::makeEepromReference(saveObject);
+
+		save = Save { 1, 10, 100 };
+
+		auto score = save.member(&Save::score);
+		auto coins = save.member(&Save::coins);
+		auto level = save.member(&Save::level);
+
+		score += 50;
+		score -= 25;
+		score *= 4;
+		score /= 2;
+		score %= 200;
+		arduboy.println(static_cast<uint32_t>(score));
+
+		coins |= 0x0F00;
+		coins &= 0xFF0F;
+		coins ^= 0x0001;
+		coins <<= 1;
+		coins >>= 2;
+		arduboy.println(static_cast<uint16_t>(coins), 16);
+
+		const uint8_t before = level++;
+		++level;
+		--level;
+		const uint8_t after = level--;
+		arduboy.print(before);
+		arduboy.print(' ');
+		arduboy.print(after);
+		arduboy.print(' ');
+		arduboy.println(static_cast<uint8_t>(level));
+
+		// Members are written without disturbing their neighbours
+		const Save result = save;
+		arduboy.print(result.level);
+		arduboy.print(' ');
+		arduboy.print(result.coins, 16);
+		arduboy.print(' ');
+		arduboy.println(result.score);
+
+		// An unchanged value costs a read but no write
+		tests::benchmark(arduboy, F("unchanged"), 1, [&](uint16_t)
+		{
+			score += 0;
+			return true;
+		});
+
+		const auto readOnly = eeprom::makeEepromReference(static_cast<const Save &>(saveObject));
+		arduboy.println(static_cast<uint32_t>(readOnly.member(&Save::score)));
+	}
+}
\ No newline at end of file
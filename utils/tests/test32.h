@@ -0,0 +1,74 @@
+#include <Arduboy2.h>
+
+#include "benchmark.h"
+
+#include "../eeprom.h"
+
+namespace test32
+{
+	// 64 bytes located 300 bytes into eeprom
+	uint8_t (& bytes)[64] = *reinterpret_cast<uint8_t (*)[64]>(300);
+
+	void test(Arduboy2 & arduboy)
+	{
+		auto array = eeprom::makeEepromArray(bytes);
+
+		uint8_t source[64];
+
+		for(uint8_t index = 0; index < 64; ++index)
+			source[index] = index;
+
+		array.writeRange(0, 64, source);
+
+		uint8_t buffer[64] {};
+
+		// Reading one byte at a time through iterators
+		tests::benchmark(arduboy, F("iter"), 1, [&](uint16_t)
+		{
+			uint8_t * output = &buffer[0];
+
+			for(auto element : array)
+				*output++ = element;
+
+			return buffer[63];
+		});
+
+		// Reading a block
+		tests::benchmark(arduboy, F("block"), 1, [&](uint16_t)
+		{
+			array.readRange(0, 64, buffer);
+			return buffer[63];
+		});
+
+		// Copying from eeprom to RAM, then back again
+		uint8_t copied[64] {};
+		uint8_t * copiedEnd = utils::copy(array.begin(), array.end(), &copied[0]);
+
+		arduboy.print(copiedEnd - &copied[0]);
+		arduboy.print(' ');
+		arduboy.println(copied[63]);
+
+		copied[10] = 0xAA;
+
+		auto outputEnd = utils::copy(&copied[0], &copied[64], array.begin());
+
+		arduboy.print(outputEnd == array.end());
+		arduboy.print(' ');
+		arduboy.println(static_cast<uint8_t>(array[10]), 16);
+
+		// Only the changed byte is written
+		source[10] = 0xAA;
+		source[20] = 0x55;
+
+		const eeprom::WriteStatistics statistics = array.updateRange(0, 64, source);
+
+		arduboy.print(statistics.compared);
+		arduboy.print(' ');
+		arduboy.println(statistics.written);
+
+		// The generic copy still works for other iterators
+		uint8_t ramCopy[4] {};
+		utils::copy(&source[8], &source[12], &ramCopy[0]);
+		arduboy.println(ramCopy[2], 16);
+	}
+}
\ No newline at end of file
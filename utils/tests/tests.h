@@ -4,4 +4,29 @@
 #include "test04.h"
 #include "test05.h"
 #include "test06.h"
-#include "test07.h"
\ No newline at end of file
+#include "test07.h"
+#include "test08.h"
+#include "test09.h"
+#include "test10.h"
+#include "test11.h"
+#include "test12.h"
+#include "test13.h"
+#include "test14.h"
+#include "test15.h"
+#include "test16.h"
+#include "test17.h"
+#include "test18.h"
+#include "test19.h"
+#include "test20.h"
+#include "test21.h"
+#include "test22.h"
+#include "test23.h"
+#include "test24.h"
+#include "test25.h"
+#include "test26.h"
+#include "test27.h"
+#include "test28.h"
+#include "test29.h"
+#include "test30.h"
+#include "test31.h"
+#include "test32.h"
\ No newline at end of file
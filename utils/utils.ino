@@ -19,7 +19,32 @@ void setup()
 	//test04::test(arduboy);
 	//test05::test(arduboy);
 	//test06::test(arduboy);
-	test07::test(arduboy);
+	//test07::test(arduboy);
+	//test08::test(arduboy);
+	//test09::test(arduboy);
+	//test10::test(arduboy);
+	//test11::test(arduboy);
+	//test12::test(arduboy);
+	//test13::test(arduboy);
+	//test14::test(arduboy);
+	//test15::test(arduboy);
+	//test16::test(arduboy);
+	//test17::test(arduboy);
+	//test18::test(arduboy);
+	//test19::test(arduboy);
+	//test20::test(arduboy);
+	//test21::test(arduboy);
+	//test22::test(arduboy);
+	//test23::test(arduboy);
+	//test24::test(arduboy);
+	//test25::test(arduboy);
+	//test26::test(arduboy);
+	//test27::test(arduboy);
+	//test28::test(arduboy);
+	//test29::test(arduboy);
+	//test30::test(arduboy);
+	//test31::test(arduboy);
+	test32::test(arduboy);
 
 	arduboy.display();
 
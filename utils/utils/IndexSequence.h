@@ -0,0 +1,71 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+namespace utils
+{
+	/// @brief
+	/// A compile-time sequence of indices,
+	/// similar to [`std::index_sequence`](https://en.cppreference.com/w/cpp/utility/integer_sequence).
+	///
+	/// @details
+	/// Primarily used to expand an array into a braced initialiser list
+	/// inside a `constexpr` function, e.g. `{ function(array, indices)... }`.
+	template<size_t ... indices>
+	struct IndexSequence
+	{
+		/// @brief
+		/// Returns the number of indices in the sequence.
+		static constexpr size_t size() noexcept
+		{
+			return sizeof...(indices);
+		}
+	};
+
+	// Entities within the `details` namespace are
+	// not considered part of the API and should not
+	// be referenced from user code as anything within
+	// the `details` namespace may be removed or renamed
+	// without warning or deprecation.
+	namespace details
+	{
+		template<typename Left, typename Right>
+		struct concatenate_index_sequence;
+
+		// Appends a copy of the right sequence, offset by the size of the left sequence
+		template<size_t ... left, size_t ... right>
+		struct concatenate_index_sequence<IndexSequence<left...>, IndexSequence<right...>>
+		{
+			using type = IndexSequence<left..., (sizeof...(left) + right)...>;
+		};
+
+		// Halves the count at every step, so that the instantiation depth is logarithmic
+		// rather than linear, allowing sequences far longer than the template depth limit
+		template<size_t count>
+		struct make_index_sequence
+		{
+			using type = typename concatenate_index_sequence<
+				typename make_index_sequence<count / 2>::type,
+				typename make_index_sequence<count - (count / 2)>::type
+			>::type;
+		};
+
+		template<>
+		struct make_index_sequence<0>
+		{
+			using type = IndexSequence<>;
+		};
+
+		template<>
+		struct make_index_sequence<1>
+		{
+			using type = IndexSequence<0>;
+		};
+	}
+
+	/// @brief
+	/// An @ref IndexSequence of the indices `0` to `count - 1`.
+	template<size_t count>
+	using MakeIndexSequence = typename details::make_index_sequence<count>::type;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+#include "IteratorPair.h"
+#include "TakeIterator.h"
+#include "details/AdvanceUtils.h"
+
+namespace utils
+{
+	/// @brief
+	/// An iterator adaptor that splits the underlying range
+	/// into consecutive chunks of up to `chunk_size` elements.
+	///
+	/// @details
+	/// Dereferencing produces an @ref IteratorPair of @ref TakeIterator objects
+	/// that refers to the elements of the current chunk.
+	/// The final chunk may be shorter than `chunk_size`.
+	template<typename Iterator>
+	class ChunkIterator
+	{
+	public:
+		using iterator_type = Iterator;
+		using size_type = size_t;
+		using chunk_type = IteratorPair<TakeIterator<iterator_type>>;
+		using value_type = chunk_type;
+		using difference_type = ptrdiff_t;
+
+	private:
+		iterator_type iterator;
+		iterator_type end_iterator;
+		size_type chunk_size;
+
+	public:
+		constexpr ChunkIterator(iterator_type iterator, iterator_type end_iterator, size_type chunk_size) :
+			iterator(iterator), end_iterator(end_iterator), chunk_size(chunk_size)
+		{
+		}
+
+		constexpr iterator_type base() const
+		{
+			return this->iterator;
+		}
+
+		chunk_type operator *() const
+		{
+			return chunk_type(TakeIterator<iterator_type>(this->iterator, this->chunk_size), TakeIterator<iterator_type>(this->end_iterator, 0));
+		}
+
+		ChunkIterator & operator ++()
+		{
+			static_cast<void>(details::advance_bounded(this->iterator, this->end_iterator, this->chunk_size));
+			return *this;
+		}
+
+		ChunkIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+	};
+
+	template<typename Iterator>
+	constexpr ChunkIterator<Iterator> makeChunkIterator(Iterator iterator, Iterator end_iterator, size_t chunk_size)
+	{
+		return ChunkIterator<Iterator>(iterator, end_iterator, chunk_size);
+	}
+
+	template<typename Iterator>
+	constexpr bool operator ==(const ChunkIterator<Iterator> & left, const ChunkIterator<Iterator> & right)
+	{
+		return (left.base() == right.base());
+	}
+
+	template<typename Iterator>
+	constexpr bool operator !=(const ChunkIterator<Iterator> & left, const ChunkIterator<Iterator> & right)
+	{
+		return (left.base() != right.base());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+#include "../Pair.h"
+#include "details/IteratorValueUtils.h"
+
+namespace utils
+{
+	/// @brief
+	/// An iterator adaptor that pairs each element of the
+	/// underlying range with its index.
+	///
+	/// @details
+	/// Dereferencing produces a @ref Pair whose `first` is the index
+	/// and whose `second` is the result of dereferencing the underlying iterator.
+	template<typename Iterator>
+	class EnumerateIterator
+	{
+	public:
+		using iterator_type = Iterator;
+		using size_type = size_t;
+		using value_type = Pair<size_type, details::iterator_value_type<iterator_type>>;
+		using difference_type = ptrdiff_t;
+
+	private:
+		iterator_type iterator;
+		size_type index;
+
+	public:
+		constexpr EnumerateIterator(iterator_type iterator, size_type index) :
+			iterator(iterator), index(index)
+		{
+		}
+
+		constexpr iterator_type base() const
+		{
+			return this->iterator;
+		}
+
+		auto operator *() const -> Pair<size_type, decltype(*this->iterator)>
+		{
+			return { this->index, *this->iterator };
+		}
+
+		EnumerateIterator & operator ++()
+		{
+			++this->iterator;
+			++this->index;
+			return *this;
+		}
+
+		EnumerateIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+	};
+
+	template<typename Iterator>
+	constexpr EnumerateIterator<Iterator> makeEnumerateIterator(Iterator iterator, size_t index = 0)
+	{
+		return EnumerateIterator<Iterator>(iterator, index);
+	}
+
+	template<typename Iterator>
+	constexpr bool operator ==(const EnumerateIterator<Iterator> & left, const EnumerateIterator<Iterator> & right)
+	{
+		return (left.base() == right.base());
+	}
+
+	template<typename Iterator>
+	constexpr bool operator !=(const EnumerateIterator<Iterator> & left, const EnumerateIterator<Iterator> & right)
+	{
+		return (left.base() != right.base());
+	}
+}
\ No newline at end of file
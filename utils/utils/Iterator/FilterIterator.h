@@ -0,0 +1,88 @@
+#pragma once
+
+// For ptrdiff_t
+#include <stddef.h>
+
+#include "details/IteratorValueUtils.h"
+
+namespace utils
+{
+	/// @brief
+	/// An iterator adaptor that skips every element of the
+	/// underlying range that does not satisfy a predicate.
+	///
+	/// @details
+	/// The iterator carries the end of the underlying range
+	/// so that it knows where to stop skipping.
+	/// The predicate is called once per element visited.
+	template<typename Iterator, typename Predicate>
+	class FilterIterator
+	{
+	public:
+		using iterator_type = Iterator;
+		using predicate_type = Predicate;
+		using value_type = details::iterator_value_type<iterator_type>;
+		using difference_type = ptrdiff_t;
+
+	private:
+		iterator_type iterator;
+		iterator_type end_iterator;
+		predicate_type predicate;
+
+	private:
+		void skip()
+		{
+			while((this->iterator != this->end_iterator) && !this->predicate(*this->iterator))
+				++this->iterator;
+		}
+
+	public:
+		FilterIterator(iterator_type iterator, iterator_type end_iterator, predicate_type predicate) :
+			iterator(iterator), end_iterator(end_iterator), predicate(predicate)
+		{
+			this->skip();
+		}
+
+		constexpr iterator_type base() const
+		{
+			return this->iterator;
+		}
+
+		auto operator *() const -> decltype(*this->iterator)
+		{
+			return *this->iterator;
+		}
+
+		FilterIterator & operator ++()
+		{
+			++this->iterator;
+			this->skip();
+			return *this;
+		}
+
+		FilterIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+	};
+
+	template<typename Iterator, typename Predicate>
+	FilterIterator<Iterator, Predicate> makeFilterIterator(Iterator iterator, Iterator end_iterator, Predicate predicate)
+	{
+		return FilterIterator<Iterator, Predicate>(iterator, end_iterator, predicate);
+	}
+
+	template<typename Iterator, typename Predicate>
+	constexpr bool operator ==(const FilterIterator<Iterator, Predicate> & left, const FilterIterator<Iterator, Predicate> & right)
+	{
+		return (left.base() == right.base());
+	}
+
+	template<typename Iterator, typename Predicate>
+	constexpr bool operator !=(const FilterIterator<Iterator, Predicate> & left, const FilterIterator<Iterator, Predicate> & right)
+	{
+		return (left.base() != right.base());
+	}
+}
\ No newline at end of file
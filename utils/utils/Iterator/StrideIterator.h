@@ -0,0 +1,78 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+#include "details/AdvanceUtils.h"
+#include "details/IteratorValueUtils.h"
+
+namespace utils
+{
+	/// @brief
+	/// An iterator adaptor that visits every `stride`th element of the underlying range.
+	///
+	/// @details
+	/// The iterator carries the end of the underlying range
+	/// so that it never steps beyond it.
+	template<typename Iterator>
+	class StrideIterator
+	{
+	public:
+		using iterator_type = Iterator;
+		using size_type = size_t;
+		using value_type = details::iterator_value_type<iterator_type>;
+		using difference_type = ptrdiff_t;
+
+	private:
+		iterator_type iterator;
+		iterator_type end_iterator;
+		size_type stride;
+
+	public:
+		constexpr StrideIterator(iterator_type iterator, iterator_type end_iterator, size_type stride) :
+			iterator(iterator), end_iterator(end_iterator), stride(stride)
+		{
+		}
+
+		constexpr iterator_type base() const
+		{
+			return this->iterator;
+		}
+
+		auto operator *() const -> decltype(*this->iterator)
+		{
+			return *this->iterator;
+		}
+
+		StrideIterator & operator ++()
+		{
+			static_cast<void>(details::advance_bounded(this->iterator, this->end_iterator, this->stride));
+			return *this;
+		}
+
+		StrideIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+	};
+
+	template<typename Iterator>
+	constexpr StrideIterator<Iterator> makeStrideIterator(Iterator iterator, Iterator end_iterator, size_t stride)
+	{
+		return StrideIterator<Iterator>(iterator, end_iterator, stride);
+	}
+
+	template<typename Iterator>
+	constexpr bool operator ==(const StrideIterator<Iterator> & left, const StrideIterator<Iterator> & right)
+	{
+		return (left.base() == right.base());
+	}
+
+	template<typename Iterator>
+	constexpr bool operator !=(const StrideIterator<Iterator> & left, const StrideIterator<Iterator> & right)
+	{
+		return (left.base() != right.base());
+	}
+}
\ No newline at end of file
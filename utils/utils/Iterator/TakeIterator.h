@@ -0,0 +1,84 @@
+#pragma once
+
+// For size_t, ptrdiff_t
+#include <stddef.h>
+
+#include "details/IteratorValueUtils.h"
+
+namespace utils
+{
+	/// @brief
+	/// An iterator adaptor that stops after a fixed number of elements,
+	/// or at the end of the underlying range, whichever comes first.
+	///
+	/// @details
+	/// Two @ref TakeIterator objects compare equal if either their
+	/// remaining counts or their underlying iterators are equal,
+	/// which allows a take of more elements than the underlying range contains.
+	template<typename Iterator>
+	class TakeIterator
+	{
+	public:
+		using iterator_type = Iterator;
+		using size_type = size_t;
+		using value_type = details::iterator_value_type<iterator_type>;
+		using difference_type = ptrdiff_t;
+
+	private:
+		iterator_type iterator;
+		size_type remaining;
+
+	public:
+		constexpr TakeIterator(iterator_type iterator, size_type remaining) :
+			iterator(iterator), remaining(remaining)
+		{
+		}
+
+		constexpr iterator_type base() const
+		{
+			return this->iterator;
+		}
+
+		constexpr size_type count() const
+		{
+			return this->remaining;
+		}
+
+		auto operator *() const -> decltype(*this->iterator)
+		{
+			return *this->iterator;
+		}
+
+		TakeIterator & operator ++()
+		{
+			++this->iterator;
+			--this->remaining;
+			return *this;
+		}
+
+		TakeIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+	};
+
+	template<typename Iterator>
+	constexpr TakeIterator<Iterator> makeTakeIterator(Iterator iterator, size_t count)
+	{
+		return TakeIterator<Iterator>(iterator, count);
+	}
+
+	template<typename Iterator>
+	constexpr bool operator ==(const TakeIterator<Iterator> & left, const TakeIterator<Iterator> & right)
+	{
+		return ((left.count() == right.count()) || (left.base() == right.base()));
+	}
+
+	template<typename Iterator>
+	constexpr bool operator !=(const TakeIterator<Iterator> & left, const TakeIterator<Iterator> & right)
+	{
+		return ((left.count() != right.count()) && (left.base() != right.base()));
+	}
+}
\ No newline at end of file
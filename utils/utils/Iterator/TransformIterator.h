@@ -0,0 +1,78 @@
+#pragma once
+
+// For ptrdiff_t
+#include <stddef.h>
+
+#include "details/IteratorValueUtils.h"
+
+namespace utils
+{
+	/// @brief
+	/// An iterator adaptor that applies a function to
+	/// each element of the underlying range as it is dereferenced.
+	///
+	/// @details
+	/// No results are stored.
+	/// The function is called every time the iterator is dereferenced,
+	/// so prefer cheap functions, or cache the result of the dereference.
+	template<typename Iterator, typename Function>
+	class TransformIterator
+	{
+	public:
+		using iterator_type = Iterator;
+		using function_type = Function;
+		using value_type = typename details::remove_const<details::forward_parameter_t<decltype(details::declare_value<const function_type &>()(*details::declare_value<const iterator_type &>()))>>::type;
+		using difference_type = ptrdiff_t;
+
+	private:
+		iterator_type iterator;
+		function_type function;
+
+	public:
+		constexpr TransformIterator(iterator_type iterator, function_type function) :
+			iterator(iterator), function(function)
+		{
+		}
+
+		constexpr iterator_type base() const
+		{
+			return this->iterator;
+		}
+
+		auto operator *() const -> decltype(this->function(*this->iterator))
+		{
+			return this->function(*this->iterator);
+		}
+
+		TransformIterator & operator ++()
+		{
+			++this->iterator;
+			return *this;
+		}
+
+		TransformIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+	};
+
+	template<typename Iterator, typename Function>
+	constexpr TransformIterator<Iterator, Function> makeTransformIterator(Iterator iterator, Function function)
+	{
+		return TransformIterator<Iterator, Function>(iterator, function);
+	}
+
+	template<typename Iterator, typename Function>
+	constexpr bool operator ==(const TransformIterator<Iterator, Function> & left, const TransformIterator<Iterator, Function> & right)
+	{
+		return (left.base() == right.base());
+	}
+
+	template<typename Iterator, typename Function>
+	constexpr bool operator !=(const TransformIterator<Iterator, Function> & left, const TransformIterator<Iterator, Function> & right)
+	{
+		return (left.base() != right.base());
+	}
+}
\ No newline at end of file
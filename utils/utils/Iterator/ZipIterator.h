@@ -0,0 +1,85 @@
+#pragma once
+
+// For ptrdiff_t
+#include <stddef.h>
+
+#include "../Pair.h"
+#include "details/IteratorValueUtils.h"
+
+namespace utils
+{
+	/// @brief
+	/// An iterator adaptor that steps through two ranges in lockstep.
+	///
+	/// @details
+	/// Dereferencing produces a @ref Pair holding the results of
+	/// dereferencing both underlying iterators.
+	/// Two @ref ZipIterator objects compare equal if either of their
+	/// underlying iterators are equal, so iteration stops at the end of the shorter range.
+	template<typename FirstIterator, typename SecondIterator>
+	class ZipIterator
+	{
+	public:
+		using first_iterator_type = FirstIterator;
+		using second_iterator_type = SecondIterator;
+		using value_type = Pair<details::iterator_value_type<first_iterator_type>, details::iterator_value_type<second_iterator_type>>;
+		using difference_type = ptrdiff_t;
+
+	private:
+		first_iterator_type first_iterator;
+		second_iterator_type second_iterator;
+
+	public:
+		constexpr ZipIterator(first_iterator_type first_iterator, second_iterator_type second_iterator) :
+			first_iterator(first_iterator), second_iterator(second_iterator)
+		{
+		}
+
+		constexpr first_iterator_type first() const
+		{
+			return this->first_iterator;
+		}
+
+		constexpr second_iterator_type second() const
+		{
+			return this->second_iterator;
+		}
+
+		auto operator *() const -> Pair<decltype(*this->first_iterator), decltype(*this->second_iterator)>
+		{
+			return { *this->first_iterator, *this->second_iterator };
+		}
+
+		ZipIterator & operator ++()
+		{
+			++this->first_iterator;
+			++this->second_iterator;
+			return *this;
+		}
+
+		ZipIterator operator ++(int)
+		{
+			auto result = *this;
+			this->operator++();
+			return result;
+		}
+	};
+
+	template<typename FirstIterator, typename SecondIterator>
+	constexpr ZipIterator<FirstIterator, SecondIterator> makeZipIterator(FirstIterator first_iterator, SecondIterator second_iterator)
+	{
+		return ZipIterator<FirstIterator, SecondIterator>(first_iterator, second_iterator);
+	}
+
+	template<typename FirstIterator, typename SecondIterator>
+	constexpr bool operator ==(const ZipIterator<FirstIterator, SecondIterator> & left, const ZipIterator<FirstIterator, SecondIterator> & right)
+	{
+		return ((left.first() == right.first()) || (left.second() == right.second()));
+	}
+
+	template<typename FirstIterator, typename SecondIterator>
+	constexpr bool operator !=(const ZipIterator<FirstIterator, SecondIterator> & left, const ZipIterator<FirstIterator, SecondIterator> & right)
+	{
+		return ((left.first() != right.first()) && (left.second() != right.second()));
+	}
+}
\ No newline at end of file
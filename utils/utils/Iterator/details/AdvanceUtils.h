@@ -0,0 +1,27 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+namespace utils
+{
+	namespace details
+	{
+		// Advances an iterator by up to 'count' steps,
+		// stopping early if 'end' is reached.
+		// Returns the number of steps actually taken.
+		template<typename Iterator>
+		size_t advance_bounded(Iterator & iterator, const Iterator & end, size_t count)
+		{
+			size_t steps = 0;
+
+			while((steps < count) && (iterator != end))
+			{
+				++iterator;
+				++steps;
+			}
+
+			return steps;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+// For forward_parameter_t
+#include "../../forward.h"
+
+namespace utils
+{
+	namespace details
+	{
+		template<typename Type>
+		struct remove_const
+		{
+			using type = Type;
+		};
+
+		template<typename Type>
+		struct remove_const<const Type>
+		{
+			using type = Type;
+		};
+
+		// Only used in unevaluated contexts, so never defined
+		template<typename Type>
+		Type && declare_value();
+
+		// The type produced by dereferencing 'Iterator',
+		// without its reference and const qualifiers
+		template<typename Iterator>
+		using iterator_value_type = typename remove_const<forward_parameter_t<decltype(*declare_value<const Iterator &>())>>::type;
+	}
+}
\ No newline at end of file
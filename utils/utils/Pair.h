@@ -0,0 +1,45 @@
+#pragma once
+
+// For forward
+#include "forward.h"
+
+namespace utils
+{
+	/// @brief
+	/// A simple aggregate holding two objects of possibly different types.
+	///
+	/// @details
+	/// Either type may be a reference type,
+	/// in which case the @ref Pair refers to an existing object
+	/// rather than holding a copy of it.
+	template<typename First, typename Second>
+	struct Pair
+	{
+		/// @brief
+		/// The type of the first object.
+		using first_type = First;
+
+		/// @brief
+		/// The type of the second object.
+		using second_type = Second;
+
+		/// @brief
+		/// The first object.
+		first_type first;
+
+		/// @brief
+		/// The second object.
+		second_type second;
+	};
+
+	/// @brief
+	/// A simpler way to construct a @ref Pair. This function allows the types to be inferred.
+	///
+	/// @note
+	/// Lvalue arguments produce a @ref Pair of references.
+	template<typename First, typename Second>
+	constexpr Pair<First, Second> makePair(First && first, Second && second)
+	{
+		return { utils::forward<First>(first), utils::forward<Second>(second) };
+	}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For begin, end
+#include "../utils.h"
+
+#include "../Iterator/IteratorPair.h"
+#include "../Iterator/ChunkIterator.h"
+
+namespace utils
+{
+	/// @brief
+	/// Creates a lazy view of `range` as consecutive chunks of up to `chunk_size` elements.
+	///
+	/// @details
+	/// Each chunk is itself a lazy view, so no elements are copied.
+	///
+	/// @warning
+	/// See the note on lifetimes in views.h.
+	template<typename Range>
+	constexpr auto chunk(Range && range, size_t chunk_size) ->
+		IteratorPair<ChunkIterator<decltype(utils::begin(range))>>
+	{
+		return IteratorPair<ChunkIterator<decltype(utils::begin(range))>>
+		(
+			ChunkIterator<decltype(utils::begin(range))>(utils::begin(range), utils::end(range), chunk_size),
+			ChunkIterator<decltype(utils::begin(range))>(utils::end(range), utils::end(range), chunk_size)
+		);
+	}
+
+	/// @brief
+	/// Holds the arguments of a @ref chunk until it is applied to a range with `operator |`.
+	struct ChunkAdaptor
+	{
+		size_t chunk_size;
+	};
+
+	/// @brief
+	/// Creates an adaptor that applies @ref chunk to a range when combined with `operator |`.
+	///
+	/// @details
+	/// E.g. `range | utils::chunk(8)`.
+	constexpr ChunkAdaptor chunk(size_t chunk_size)
+	{
+		return { chunk_size };
+	}
+
+	/// @brief
+	/// Applies a @ref ChunkAdaptor to a range.
+	template<typename Range>
+	constexpr auto operator |(Range && range, const ChunkAdaptor & adaptor) ->
+		decltype(utils::chunk(range, adaptor.chunk_size))
+	{
+		return utils::chunk(range, adaptor.chunk_size);
+	}
+}
\ No newline at end of file
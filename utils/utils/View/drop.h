@@ -0,0 +1,58 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For begin, end
+#include "../utils.h"
+
+#include "../Iterator/IteratorPair.h"
+#include "../Iterator/details/AdvanceUtils.h"
+
+namespace utils
+{
+	/// @brief
+	/// Creates a view of `range` that skips the first `count` elements.
+	///
+	/// @details
+	/// If `range` has fewer than `count` elements, the view is empty.
+	/// The skipped elements are stepped over once, when the view is created.
+	///
+	/// @warning
+	/// See the note on lifetimes in views.h.
+	template<typename Range>
+	auto drop(Range && range, size_t count) ->
+		IteratorPair<decltype(utils::begin(range))>
+	{
+		auto begin_iterator = utils::begin(range);
+		auto end_iterator = utils::end(range);
+		static_cast<void>(details::advance_bounded(begin_iterator, end_iterator, count));
+		return IteratorPair<decltype(utils::begin(range))>(utils::move(begin_iterator), utils::move(end_iterator));
+	}
+
+	/// @brief
+	/// Holds the arguments of a @ref drop until it is applied to a range with `operator |`.
+	struct DropAdaptor
+	{
+		size_t count;
+	};
+
+	/// @brief
+	/// Creates an adaptor that applies @ref drop to a range when combined with `operator |`.
+	///
+	/// @details
+	/// E.g. `range | utils::drop(4)`.
+	constexpr DropAdaptor drop(size_t count)
+	{
+		return { count };
+	}
+
+	/// @brief
+	/// Applies a @ref DropAdaptor to a range.
+	template<typename Range>
+	auto operator |(Range && range, const DropAdaptor & adaptor) ->
+		decltype(utils::drop(range, adaptor.count))
+	{
+		return utils::drop(range, adaptor.count);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+// For begin, end
+#include "../utils.h"
+
+#include "../Iterator/IteratorPair.h"
+#include "../Iterator/EnumerateIterator.h"
+
+namespace utils
+{
+	/// @brief
+	/// Creates a lazy view of `range` in which each element is paired with its index.
+	///
+	/// @warning
+	/// See the note on lifetimes in views.h.
+	template<typename Range>
+	constexpr auto enumerate(Range && range) ->
+		IteratorPair<EnumerateIterator<decltype(utils::begin(range))>>
+	{
+		return IteratorPair<EnumerateIterator<decltype(utils::begin(range))>>
+		(
+			EnumerateIterator<decltype(utils::begin(range))>(utils::begin(range), 0),
+			EnumerateIterator<decltype(utils::begin(range))>(utils::end(range), 0)
+		);
+	}
+
+	/// @brief
+	/// Represents a @ref enumerate until it is applied to a range with `operator |`.
+	struct EnumerateAdaptor
+	{
+	};
+
+	/// @brief
+	/// Creates an adaptor that applies @ref enumerate to a range when combined with `operator |`.
+	///
+	/// @details
+	/// E.g. `range | utils::enumerate()`.
+	constexpr EnumerateAdaptor enumerate()
+	{
+		return {};
+	}
+
+	/// @brief
+	/// Applies an @ref EnumerateAdaptor to a range.
+	template<typename Range>
+	constexpr auto operator |(Range && range, const EnumerateAdaptor &) ->
+		decltype(utils::enumerate(range))
+	{
+		return utils::enumerate(range);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+// For begin, end
+#include "../utils.h"
+
+#include "../Iterator/IteratorPair.h"
+#include "../Iterator/FilterIterator.h"
+
+namespace utils
+{
+	/// @brief
+	/// Creates a lazy view of the elements of `range` that satisfy `predicate`.
+	///
+	/// @warning
+	/// See the note on lifetimes in views.h.
+	template<typename Range, typename Predicate>
+	auto filter(Range && range, Predicate predicate) ->
+		IteratorPair<FilterIterator<decltype(utils::begin(range)), Predicate>>
+	{
+		return IteratorPair<FilterIterator<decltype(utils::begin(range)), Predicate>>
+		(
+			FilterIterator<decltype(utils::begin(range)), Predicate>(utils::begin(range), utils::end(range), predicate),
+			FilterIterator<decltype(utils::begin(range)), Predicate>(utils::end(range), utils::end(range), predicate)
+		);
+	}
+
+	/// @brief
+	/// Holds the arguments of a @ref filter until it is applied to a range with `operator |`.
+	template<typename Predicate>
+	struct FilterAdaptor
+	{
+		Predicate predicate;
+	};
+
+	/// @brief
+	/// Creates an adaptor that applies @ref filter to a range when combined with `operator |`.
+	///
+	/// @details
+	/// E.g. `range | utils::filter(predicate)`.
+	template<typename Predicate>
+	constexpr FilterAdaptor<Predicate> filter(Predicate predicate)
+	{
+		return { predicate };
+	}
+
+	/// @brief
+	/// Applies a @ref FilterAdaptor to a range.
+	template<typename Range, typename Predicate>
+	auto operator |(Range && range, const FilterAdaptor<Predicate> & adaptor) ->
+		decltype(utils::filter(range, adaptor.predicate))
+	{
+		return utils::filter(range, adaptor.predicate);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For begin, end
+#include "../utils.h"
+
+#include "../Iterator/IteratorPair.h"
+#include "../Iterator/StrideIterator.h"
+
+namespace utils
+{
+	/// @brief
+	/// Creates a lazy view of every `stride`th element of `range`,
+	/// starting with the first.
+	///
+	/// @warning
+	/// See the note on lifetimes in views.h.
+	template<typename Range>
+	constexpr auto stride(Range && range, size_t stride) ->
+		IteratorPair<StrideIterator<decltype(utils::begin(range))>>
+	{
+		return IteratorPair<StrideIterator<decltype(utils::begin(range))>>
+		(
+			StrideIterator<decltype(utils::begin(range))>(utils::begin(range), utils::end(range), stride),
+			StrideIterator<decltype(utils::begin(range))>(utils::end(range), utils::end(range), stride)
+		);
+	}
+
+	/// @brief
+	/// Holds the arguments of a @ref stride until it is applied to a range with `operator |`.
+	struct StrideAdaptor
+	{
+		size_t stride;
+	};
+
+	/// @brief
+	/// Creates an adaptor that applies @ref stride to a range when combined with `operator |`.
+	///
+	/// @details
+	/// E.g. `range | utils::stride(2)`.
+	constexpr StrideAdaptor stride(size_t stride)
+	{
+		return { stride };
+	}
+
+	/// @brief
+	/// Applies a @ref StrideAdaptor to a range.
+	template<typename Range>
+	constexpr auto operator |(Range && range, const StrideAdaptor & adaptor) ->
+		decltype(utils::stride(range, adaptor.stride))
+	{
+		return utils::stride(range, adaptor.stride);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For begin, end
+#include "../utils.h"
+
+#include "../Iterator/IteratorPair.h"
+#include "../Iterator/TakeIterator.h"
+
+namespace utils
+{
+	/// @brief
+	/// Creates a lazy view of the first `count` elements of `range`.
+	///
+	/// @details
+	/// If `range` has fewer than `count` elements,
+	/// the view contains all of the elements of `range`.
+	///
+	/// @warning
+	/// See the note on lifetimes in views.h.
+	template<typename Range>
+	constexpr auto take(Range && range, size_t count) ->
+		IteratorPair<TakeIterator<decltype(utils::begin(range))>>
+	{
+		return IteratorPair<TakeIterator<decltype(utils::begin(range))>>
+		(
+			TakeIterator<decltype(utils::begin(range))>(utils::begin(range), count),
+			TakeIterator<decltype(utils::begin(range))>(utils::end(range), 0)
+		);
+	}
+
+	/// @brief
+	/// Holds the arguments of a @ref take until it is applied to a range with `operator |`.
+	struct TakeAdaptor
+	{
+		size_t count;
+	};
+
+	/// @brief
+	/// Creates an adaptor that applies @ref take to a range when combined with `operator |`.
+	///
+	/// @details
+	/// E.g. `range | utils::take(4)`.
+	constexpr TakeAdaptor take(size_t count)
+	{
+		return { count };
+	}
+
+	/// @brief
+	/// Applies a @ref TakeAdaptor to a range.
+	template<typename Range>
+	constexpr auto operator |(Range && range, const TakeAdaptor & adaptor) ->
+		decltype(utils::take(range, adaptor.count))
+	{
+		return utils::take(range, adaptor.count);
+	}
+}
\ No newline at end of file
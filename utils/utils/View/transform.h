@@ -0,0 +1,55 @@
+#pragma once
+
+// For begin, end
+#include "../utils.h"
+
+#include "../Iterator/IteratorPair.h"
+#include "../Iterator/TransformIterator.h"
+
+namespace utils
+{
+	/// @brief
+	/// Creates a lazy view of `range` in which each element
+	/// is replaced by the result of calling `function` on it.
+	///
+	/// @warning
+	/// See the note on lifetimes in views.h.
+	template<typename Range, typename Function>
+	constexpr auto transform(Range && range, Function function) ->
+		IteratorPair<TransformIterator<decltype(utils::begin(range)), Function>>
+	{
+		return IteratorPair<TransformIterator<decltype(utils::begin(range)), Function>>
+		(
+			TransformIterator<decltype(utils::begin(range)), Function>(utils::begin(range), function),
+			TransformIterator<decltype(utils::begin(range)), Function>(utils::end(range), function)
+		);
+	}
+
+	/// @brief
+	/// Holds the arguments of a @ref transform until it is applied to a range with `operator |`.
+	template<typename Function>
+	struct TransformAdaptor
+	{
+		Function function;
+	};
+
+	/// @brief
+	/// Creates an adaptor that applies @ref transform to a range when combined with `operator |`.
+	///
+	/// @details
+	/// E.g. `range | utils::transform(function)`.
+	template<typename Function>
+	constexpr TransformAdaptor<Function> transform(Function function)
+	{
+		return { function };
+	}
+
+	/// @brief
+	/// Applies a @ref TransformAdaptor to a range.
+	template<typename Range, typename Function>
+	constexpr auto operator |(Range && range, const TransformAdaptor<Function> & adaptor) ->
+		decltype(utils::transform(range, adaptor.function))
+	{
+		return utils::transform(range, adaptor.function);
+	}
+}
\ No newline at end of file
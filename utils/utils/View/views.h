@@ -0,0 +1,20 @@
+#pragma once
+
+// Lazy range views.
+// Each view is an IteratorPair of adapted iterators,
+// so views can be combined freely with operator |
+// without allocating or copying any elements.
+//
+// Lifetimes:
+// A view refers to the elements of the ranges it was created from
+// rather than copying them, so a view must not be used after
+// any of those ranges has been destroyed.
+
+#include "transform.h"
+#include "filter.h"
+#include "take.h"
+#include "drop.h"
+#include "zip.h"
+#include "enumerate.h"
+#include "stride.h"
+#include "chunk.h"
\ No newline at end of file
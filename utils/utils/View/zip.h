@@ -0,0 +1,61 @@
+#pragma once
+
+// For begin, end
+#include "../utils.h"
+
+#include "../Iterator/IteratorPair.h"
+#include "../Iterator/ZipIterator.h"
+
+namespace utils
+{
+	/// @brief
+	/// Creates a lazy view that steps through `first` and `second` in lockstep.
+	///
+	/// @details
+	/// The view ends when either range ends.
+	///
+	/// @warning
+	/// See the note on lifetimes in views.h.
+	template<typename FirstRange, typename SecondRange>
+	constexpr auto zip(FirstRange && first, SecondRange && second) ->
+		IteratorPair<ZipIterator<decltype(utils::begin(first)), decltype(utils::begin(second))>>
+	{
+		return IteratorPair<ZipIterator<decltype(utils::begin(first)), decltype(utils::begin(second))>>
+		(
+			ZipIterator<decltype(utils::begin(first)), decltype(utils::begin(second))>(utils::begin(first), utils::begin(second)),
+			ZipIterator<decltype(utils::begin(first)), decltype(utils::begin(second))>(utils::end(first), utils::end(second))
+		);
+	}
+
+	/// @brief
+	/// Holds the second range of a @ref zip until it is applied to a range with `operator |`.
+	///
+	/// @details
+	/// Only the iterators of the second range are held, not the range itself.
+	template<typename Iterator>
+	struct ZipAdaptor
+	{
+		IteratorPair<Iterator> range;
+	};
+
+	/// @brief
+	/// Creates an adaptor that applies @ref zip to a range when combined with `operator |`.
+	///
+	/// @details
+	/// E.g. `first | utils::zip(second)`.
+	template<typename Range>
+	constexpr auto zip(Range && range) ->
+		ZipAdaptor<decltype(utils::begin(range))>
+	{
+		return { IteratorPair<decltype(utils::begin(range))>(utils::begin(range), utils::end(range)) };
+	}
+
+	/// @brief
+	/// Applies a @ref ZipAdaptor to a range.
+	template<typename Range, typename Iterator>
+	constexpr auto operator |(Range && range, const ZipAdaptor<Iterator> & adaptor) ->
+		decltype(utils::zip(range, adaptor.range))
+	{
+		return utils::zip(range, adaptor.range);
+	}
+}
\ No newline at end of file
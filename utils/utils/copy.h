@@ -0,0 +1,24 @@
+#pragma once
+
+namespace utils
+{
+	/// @brief
+	/// Copies the elements in the range [`first`, `last`) to the range beginning at `output`.
+	///
+	/// @return
+	/// An iterator pointing beyond the last element copied.
+	///
+	/// @note
+	/// @parblock
+	/// Overloads for ranges of @ref eeprom::EepromPointer
+	/// are provided by `eeprom/copy.h`, which copy a block at a time.
+	/// @endparblock
+	template<typename InputIterator, typename OutputIterator>
+	OutputIterator copy(InputIterator first, InputIterator last, OutputIterator output)
+	{
+		for(; first != last; ++first, ++output)
+			*output = *first;
+
+		return output;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+namespace utils
+{
+	namespace details
+	{
+		constexpr bool is_power_of_two(size_t value)
+		{
+			return ((value != 0) && ((value & (value - 1)) == 0));
+		}
+
+		constexpr uint8_t floor_log2(size_t value)
+		{
+			return (value <= 1) ? 0 : (1 + floor_log2(value >> 1));
+		}
+
+		// Default behaviour - multiply by the row stride
+		template<size_t width, bool = is_power_of_two(width)>
+		struct grid_index_helper
+		{
+			static constexpr size_t index(size_t x, size_t y)
+			{
+				return ((y * width) + x);
+			}
+		};
+
+		// Special behaviour for power-of-two strides - shift instead of multiplying
+		template<size_t width>
+		struct grid_index_helper<width, true>
+		{
+			static constexpr size_t index(size_t x, size_t y)
+			{
+				return ((y << floor_log2(width)) + x);
+			}
+		};
+	}
+
+	/// @brief
+	/// Returns the index of the element at (`x`, `y`)
+	/// in a flattened row-major grid with `width` columns.
+	///
+	/// @details
+	/// If `width` is a power of two, the row is found
+	/// with a shift rather than a multiplication.
+	template<size_t width>
+	constexpr size_t gridIndex(size_t x, size_t y)
+	{
+		return details::grid_index_helper<width>::index(x, y);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+// For size_t
+#include <stddef.h>
+
+// For uint32_t
+#include <stdint.h>
+
+namespace utils
+{
+	// Entities within the `details` namespace are
+	// not considered part of the API and should not
+	// be referenced from user code as anything within
+	// the `details` namespace may be removed or renamed
+	// without warning or deprecation.
+	namespace details
+	{
+		constexpr uint32_t fnv1a_offset_basis = 2166136261u;
+		constexpr uint32_t fnv1a_prime = 16777619u;
+
+		constexpr uint32_t fnv1a_step(uint32_t hash, char character)
+		{
+			return ((hash ^ static_cast<unsigned char>(character)) * fnv1a_prime);
+		}
+
+		constexpr uint32_t fnv1a(const char * string, uint32_t hash)
+		{
+			return (*string == '\0') ? hash : fnv1a(string + 1, fnv1a_step(hash, *string));
+		}
+	}
+
+	/// @brief
+	/// Computes the 32-bit FNV-1a hash of a null-terminated string at compile time.
+	///
+	/// @details
+	/// Intended for hashing string literals, or `constexpr` character arrays,
+	/// including those stored in progmem.
+	/// The null character is not included in the hash,
+	/// so the result is the same as @ref fnv1a(const char *, size_t)
+	/// for the same characters.
+	///
+	/// @note
+	/// This function is recursive so that it can be used in `constexpr` contexts.
+	/// Prefer @ref fnv1a(const char *, size_t) for hashing at runtime.
+	constexpr uint32_t fnv1a(const char * string)
+	{
+		return details::fnv1a(string, details::fnv1a_offset_basis);
+	}
+
+	/// @brief
+	/// Computes the 32-bit FNV-1a hash of `size` characters in RAM.
+	///
+	/// @details
+	/// The characters need not be null-terminated,
+	/// so this function can hash a token directly within a larger buffer.
+	inline uint32_t fnv1a(const char * data, size_t size)
+	{
+		uint32_t hash = details::fnv1a_offset_basis;
+
+		for(size_t index = 0; index < size; ++index)
+			hash = details::fnv1a_step(hash, data[index]);
+
+		return hash;
+	}
+}
\ No newline at end of file
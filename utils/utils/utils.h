@@ -6,8 +6,13 @@ namespace utils {}
 #include "swap.h"
 #include "forward.h"
 #include "exchange.h"
+#include "copy.h"
 #include "size.h"
 #include "begin.h"
 #include "end.h"
 
-#include "Array.h"
\ No newline at end of file
+#include "Array.h"
+#include "Pair.h"
+#include "IndexSequence.h"
+#include "hash.h"
+#include "gridIndex.h"
\ No newline at end of file